@@ -10,6 +10,8 @@ if(_INPUT_GENERATE_MODE)
 // Auto generated file
 #include <string_view>
 
+#define AOC_EMBEDDED_INPUT 1
+
 inline constexpr char inputBytes[]{
 @content@
 };
@@ -32,6 +34,10 @@ endif()
 
 set(_INPUTS_SCRIPT ${CMAKE_CURRENT_LIST_FILE} CACHE INTERNAL "Path to Inputs.cmake script")
 
+# embedded inputs make GetInput() constexpr, runtime ones are mapped in memory on
+# first use and can be swapped without rebuilding (see GetInputPath())
+option(AOC_RUNTIME_INPUTS "Read the puzzle inputs at runtime instead of embedding them" OFF)
+
 function(add_aoc_input year day)
   set(libname "resources-${year}-${day}")
   set(input_file "${CMAKE_SOURCE_DIR}/inputs/${year}/day${day}.txt")
@@ -39,6 +45,32 @@ function(add_aoc_input year day)
   add_library(${libname} INTERFACE EXCLUDE_FROM_ALL ${output_file})
   target_include_directories(${libname} INTERFACE "${CMAKE_BINARY_DIR}/inputs/${year}/${day}")
 
+  if(AOC_RUNTIME_INPUTS)
+    target_include_directories(${libname} INTERFACE "${CMAKE_SOURCE_DIR}/src")
+    file(CONFIGURE OUTPUT ${output_file} CONTENT [[
+// Auto generated file
+#include "cpp-utils/input-file.hpp"
+
+#include <string_view>
+
+#define AOC_EMBEDDED_INPUT 0
+
+inline std::string_view GetInput()
+{
+    static MappedFile const file{GetInputPath(@year@, @day@, "@input_file@")};
+    std::string_view text = file.Text();
+
+    if (auto const pos = text.find_last_not_of("\r\n"); pos != text.npos)
+    {
+        text = text.substr(0, pos + 1);
+    }
+
+    return text;
+}
+]] @ONLY)
+    return()
+  endif()
+
   add_custom_command(
     OUTPUT ${output_file}
     DEPENDS ${input_file} ${_INPUTS_SCRIPT}
@@ -0,0 +1,82 @@
+# aoc-runner links every day into a single executable. Each day source is
+# included inside its own namespace so that identically named helpers (and the
+# generated GetInput()) from different days do not collide.
+
+function(add_aoc_runner_day year day)
+  set(libname "runner-${year}-${day}")
+  set(output_file "${CMAKE_BINARY_DIR}/runner/${year}/day${day}.cpp")
+  set(day_source "${CMAKE_SOURCE_DIR}/src/${year}/day${day}.cpp")
+
+  file(CONFIGURE OUTPUT ${output_file} CONTENT [[
+// Auto generated file
+#include "runner/prelude.hpp"
+
+namespace aoc_@year@_@day@
+{
+#include "@day_source@"
+}
+]] @ONLY)
+
+  add_library(${libname} OBJECT EXCLUDE_FROM_ALL ${output_file})
+  target_include_directories(${libname} PRIVATE "${CMAKE_SOURCE_DIR}/src")
+  target_link_libraries(${libname} PRIVATE cpp-utils resources-${year}-${day})
+  set_property(GLOBAL APPEND PROPERTY _AOC_RUNNER_DAYS "${year}_${day}")
+endfunction()
+
+function(_add_aoc_runner)
+  get_property(days GLOBAL PROPERTY _AOC_RUNNER_DAYS)
+  set(declarations "")
+  set(entries "")
+  set(libraries "")
+  set(years "")
+
+  foreach(id IN LISTS days)
+    string(REPLACE "_" ";" parts ${id})
+    list(GET parts 0 year)
+    list(GET parts 1 day)
+    string(APPEND declarations "namespace aoc_${id} { void Solve(Puzzle &puzzle); }\n")
+    string(APPEND entries "        {${year}, ${day}, &aoc_${id}::Solve},\n")
+    list(APPEND libraries runner-${year}-${day})
+    list(APPEND years ${year})
+  endforeach()
+
+  set(registry_file "${CMAKE_BINARY_DIR}/runner/registry.cpp")
+  file(CONFIGURE OUTPUT ${registry_file} CONTENT [[
+// Auto generated file
+#include "runner/registry.hpp"
+
+@declarations@
+std::span<Solver const> GetSolvers()
+{
+    static constexpr Solver solvers[]{
+@entries@    };
+
+    return solvers;
+}
+]] @ONLY)
+
+  add_executable(aoc-runner
+    src/runner/prelude.hpp
+    src/runner/registry.hpp
+    src/runner/report.cpp
+    src/runner/report.hpp
+    src/runner/runner.cpp
+    src/runner/scheduler.cpp
+    src/runner/scheduler.hpp
+    ${registry_file}
+  )
+  target_include_directories(aoc-runner PRIVATE "${CMAKE_SOURCE_DIR}/src")
+  find_package(Threads REQUIRED)
+  target_link_libraries(aoc-runner PRIVATE cpp-utils nlohmann_json::nlohmann_json Threads::Threads ${libraries})
+  set_property(TARGET aoc-runner APPEND PROPERTY ADDITIONAL_CLEAN_FILES aoc-runner.pdb)
+
+  add_custom_target(run aoc-runner DEPENDS aoc-runner)
+  list(REMOVE_DUPLICATES years)
+
+  foreach(year IN LISTS years)
+    add_custom_target(run-${year} aoc-runner ${year} DEPENDS aoc-runner)
+  endforeach()
+endfunction()
+
+# the runner is created once every add_aoc() call has been processed
+cmake_language(DEFER CALL _add_aoc_runner)
@@ -220,6 +220,8 @@ const Aoc = struct {
             \\// auto-generated file
             \\#include <string_view>
             \\
+            \\#define AOC_EMBEDDED_INPUT 1
+            \\
             \\static constexpr char inputBytes[]{any};
             \\
             \\constexpr std::string_view GetInput()
@@ -261,7 +263,12 @@ const Aoc = struct {
 
         cppUtils.root_module.addCSourceFiles(.{
             .files = &.{
+                "src/cpp-utils/allocations.cpp",
+                "src/cpp-utils/benchmark.cpp",
+                "src/cpp-utils/input-file.cpp",
                 "src/cpp-utils/intcode.cpp",
+                "src/cpp-utils/perf.cpp",
+                "src/cpp-utils/puzzle.cpp",
                 "src/cpp-utils/string.cpp",
                 "src/cpp-utils/terminal.cpp",
             },
@@ -305,6 +312,11 @@ const Aoc = struct {
             .flags = cppFlags,
             .language = .cpp,
         });
+        exe.root_module.addCSourceFile(.{
+            .file = b.path("src/cpp-utils/puzzle-main.cpp"),
+            .flags = cppFlags,
+            .language = .cpp,
+        });
 
         for (self.deps) |dep| {
             const lazyDep = b.lazyDependency(dep.name, .{
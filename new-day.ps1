@@ -225,7 +225,8 @@ function create-cpp
 {
     $cppText = @"
 #include "day$Day.hpp"
-#include "../common.hpp"
+
+#include "../cpp-utils.hpp"
 
 static auto Part1()
 {
@@ -237,18 +238,22 @@ static auto Part2()
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/$Year/day/$Day
-    fmt::print("Day $Day, ${Year}: \n");
-
-    auto const part1 = Part1();
-    fmt::print("  Part 1: {}\n", part1);
-    // Assert( == part1);
-
-    auto const part2 = Part2();
-    fmt::print("  Part 2: {}\n", part2);
-    // Assert( == part2);
+    puzzle.Title($Year, $Day, "");
+
+    puzzle.Part(1,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
 "@
 
@@ -48,10 +48,10 @@ static constexpr int get_pos_at_depth(std::string_view data, int const depth)
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/1
-    std::println("Day 1, 2015: Not Quite Lisp");
+    puzzle.Title(2015, 1, "Not Quite Lisp");
 
     static_assert(0 == get_depth("(())"));
     static_assert(0 == get_depth("()()"));
@@ -64,11 +64,24 @@ int main()
     static_assert(1 == get_pos_at_depth(")", -1));
     static_assert(5 == get_pos_at_depth("()())", -1));
 
-    constexpr int part1 = get_depth(GetInput());
-    static_assert(232 == part1);
-    std::println("  Part1: {}", part1);
+#if AOC_EMBEDDED_INPUT
+    static_assert(232 == get_depth(GetInput()));
+    static_assert(1783 == get_pos_at_depth(GetInput(), -1));
+#endif
 
-    constexpr int part2 = get_pos_at_depth(GetInput(), -1);
-    static_assert(1783 == part2);
-    std::println("  Part2: {}", part2);
+    // nothing but views on the input
+    puzzle.AllocationBudget(1, 0);
+    puzzle.AllocationBudget(2, 0);
+
+    puzzle.Part(1, 232,
+        []
+        {
+            return get_depth(GetInput());
+        });
+
+    puzzle.Part(2, 1783,
+        []
+        {
+            return get_pos_at_depth(GetInput(), -1);
+        });
 }
@@ -1,8 +1,8 @@
 #include "day10.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 
-#include <print>
 #include <sstream>
 #include <string>
 
@@ -54,10 +54,10 @@ int Part2()
     return static_cast<int>(LookAndSayLoop(50).size());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/10
-    std::println("Day 10, 2015: Elves Look, Elves Say");
+    puzzle.Title(2015, 10, "Elves Look, Elves Say");
 
     Assert("11" == LookAndSay("1"));
     Assert("21" == LookAndSay("11"));
@@ -65,11 +65,15 @@ int main()
     Assert("111221" == LookAndSay("1211"));
     Assert("312211" == LookAndSay("111221"));
 
-    int const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(252'594 == part1);
+    puzzle.Part(1, 252'594,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(3'579'328 == part2);
+    puzzle.Part(2, 3'579'328,
+        []
+        {
+            return Part2();
+        });
 }
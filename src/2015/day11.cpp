@@ -1,8 +1,7 @@
 #include "day11.hpp"
 
 #include "../cpp-utils/assert.hpp"
-
-#include <print>
+#include "../cpp-utils/puzzle.hpp"
 
 bool IsForbiddenLetter(char c)
 {
@@ -122,10 +121,10 @@ std::string NextPassword(std::string_view text)
     return nextPassword;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/11
-    std::println("Day 11, 2015: Corporate Policy");
+    puzzle.Title(2015, 11, "Corporate Policy");
 
     Assert(HasStraight("hijklmmn"));
     Assert(HasRepeats("abbceffg"));
@@ -134,11 +133,15 @@ int main()
     Assert("abcdffaa" == NextPassword("abcdefgh"));
     Assert("ghjaabcc" == NextPassword("ghijklmn"));
 
-    auto const part1 = NextPassword(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert("hepxxyzz" == part1);
+    puzzle.Part(1, "hepxxyzz",
+        []
+        {
+            return NextPassword(GetInput());
+        });
 
-    auto const part2 = NextPassword(part1);
-    std::println("  Part 2: {}", part2);
-    Assert("heqaabcc" == part2);
+    puzzle.Part(2, "heqaabcc",
+        []
+        {
+            return NextPassword(NextPassword(GetInput()));
+        });
 }
@@ -1,11 +1,11 @@
 #include "day12.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 
 #include <algorithm>
 #include <nlohmann/json.hpp>
 #include <numeric>
-#include <print>
 #include <regex>
 
 using json = nlohmann::json;
@@ -63,10 +63,10 @@ static int SumAllNumbersNoRed(std::string_view text)
     return SumAllNumbers(json::parse(text), true);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/12
-    std::println("Day 12, 2015: JSAbacusFramework.io");
+    puzzle.Title(2015, 12, "JSAbacusFramework.io");
 
     Assert(6 == SumAllNumbers(R"([1,2,3])"));
     Assert(6 == SumAllNumbers(R"({"a":2,"b":4})"));
@@ -82,11 +82,15 @@ int main()
     Assert(0 == SumAllNumbersNoRed(R"({"d":"red","e":[1,2,3,4],"f":5})"));
     Assert(6 == SumAllNumbersNoRed(R"([1,"red",5])"));
 
-    int const part1 = SumAllNumbers(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(191'164 == part1);
+    puzzle.Part(1, 191'164,
+        []
+        {
+            return SumAllNumbers(GetInput());
+        });
 
-    int const part2 = SumAllNumbersNoRed(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(87'842 == part2);
+    puzzle.Part(2, 87'842,
+        []
+        {
+            return SumAllNumbersNoRed(GetInput());
+        });
 }
@@ -1,113 +1,93 @@
 #include "day13.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/utils.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <print>
-#include <string>
+#include <tuple>
 #include <vector>
 
-struct Relation
+// happiness of each person next to each other, by the ids of their names
+struct Table
 {
-    std::string left;
-    std::string right;
-    int happiness;
-
-    Relation(std::string_view left_, std::string_view right_, int happiness_)
-        : left(left_)
-        , right(right_)
-        , happiness(happiness_)
+    Interner people;
+    std::vector<int> happiness;
+
+    [[nodiscard]] int Get(std::uint32_t person, std::uint32_t neighbor) const
     {
-        rtrim_if(right,
-            [](int ch)
-            {
-                return ch == '.';
-            });
+        return happiness[person * people.Size() + neighbor];
     }
 };
 
-static int GetHappiness(std::vector<Relation> const &relations, std::string_view left, std::string_view right)
+// with me, the guest nobody cares about
+static Table ParseTable(std::string_view text, bool withMe = false)
 {
-    int totalHappiness = 0;
-    auto iter = std::find_if(begin(relations), end(relations),
-        [&](Relation const &rel)
-        {
-            return rel.left == left && rel.right == right;
-        });
+    Table table;
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, int>> relations;
 
-    if (iter != end(relations))
+    for (auto &&line : Lines(text))
     {
-        totalHappiness += iter->happiness;
-    }
-
-    iter = std::find_if(begin(relations), end(relations),
-        [&](Relation const &rel)
+        if (line.empty())
         {
-            return rel.left == right && rel.right == left;
-        });
-
-    if (iter != end(relations))
-    {
-        totalHappiness += iter->happiness;
-    }
-
-    return totalHappiness;
-}
-
-static std::vector<Relation> ParseRelations(std::string_view text)
-{
-    std::vector<Relation> relations;
+            continue;
+        }
 
-    for (auto &&line : Split(text, '\n'))
-    {
+        // Alice would gain 54 happiness units by sitting next to Bob.
         auto const parts = Split(line, ' ');
-        Relation &r = relations.emplace_back(parts[0], parts[10], svtoi(parts[3]));
+        auto const person = table.people.Intern(parts[0]);
+        auto neighborName = parts[10];
 
-        if (parts[2] == "lose")
+        if (neighborName.ends_with('.'))
         {
-            r.happiness = -r.happiness;
+            neighborName.remove_suffix(1);
         }
+
+        auto const neighbor = table.people.Intern(neighborName);
+        int const happiness = svtoi(parts[3]);
+        relations.emplace_back(person, neighbor, parts[2] == "lose" ? -happiness : happiness);
     }
 
-    return relations;
-}
+    if (withMe)
+    {
+        table.people.Intern("Moi");
+    }
 
-static std::vector<std::string> GetPeople(std::vector<Relation> const &relations)
-{
-    std::vector<std::string> people;
+    auto const n = table.people.Size();
+    table.happiness.assign(n * n, 0);
 
-    for (auto &&r : relations)
+    for (auto const &[person, neighbor, happiness] : relations)
     {
-        insert_sorted(people, r.left);
+        table.happiness[person * n + neighbor] = happiness;
     }
 
-    return people;
+    return table;
 }
 
-static int ComputeBestHappiness(std::vector<Relation> const &relations, std::vector<std::string> people)
+static int ComputeBestHappiness(Table const &table)
 {
+    std::vector<std::uint32_t> people(table.people.Size());
+    std::iota(begin(people), end(people), 0U);
     int bestHappiness = 0;
 
     do
     {
-        std::string prev;
         int totalHappiness = 0;
 
-        for (auto &&person : people)
+        for (std::size_t i = 0; i != people.size(); ++i)
         {
-            if (not prev.empty())
-            {
-                totalHappiness += GetHappiness(relations, prev, person);
-            }
-
+            auto const person = people[i];
+            auto const next = people[(i + 1) % people.size()];
+            totalHappiness += table.Get(person, next) + table.Get(next, person);
 #if DEBUG_PRINT
-            std::print("{} -> ", person);
+            std::print("{} -> ", table.people.Name(person));
 #endif
-            prev = person;
         }
 
-        totalHappiness += GetHappiness(relations, prev, people.front());
         bestHappiness = std::max(bestHappiness, totalHappiness);
 #if DEBUG_PRINT
         std::println("{}", totalHappiness);
@@ -120,9 +100,7 @@ static int ComputeBestHappiness(std::vector<Relation> const &relations, std::vec
 
 static int ComputeBestHappiness(std::string_view text)
 {
-    std::vector<Relation> relations = ParseRelations(text);
-    std::vector<std::string> people = GetPeople(relations);
-    return ComputeBestHappiness(relations, people);
+    return ComputeBestHappiness(ParseTable(text));
 }
 
 static int Part1()
@@ -132,25 +110,25 @@ static int Part1()
 
 static int Part2()
 {
-    std::vector<Relation> relations = ParseRelations(GetInput());
-    std::vector<std::string> people = GetPeople(relations);
-    using namespace std::string_literals;
-    insert_sorted(people, "Moi"s);
-    return ComputeBestHappiness(relations, people);
+    return ComputeBestHappiness(ParseTable(GetInput(), true));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/13
-    std::println("Day 13, 2015: Knights of the Dinner Table");
+    puzzle.Title(2015, 13, "Knights of the Dinner Table");
 
     Assert(330 == ComputeBestHappiness(example::data));
 
-    int const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(709 == part1);
+    puzzle.Part(1, 709,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(668 == part2);
+    puzzle.Part(2, 668,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,10 +1,10 @@
 #include "day14.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <algorithm>
-#include <print>
 #include <vector>
 
 struct Deer
@@ -48,7 +48,7 @@ std::vector<Deer> ParseDeers(std::string_view text)
 {
     std::vector<Deer> deers;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         deers.emplace_back(Deer::Parse(line));
     }
@@ -105,10 +105,10 @@ int Part2()
     return GetWinnerPoints(GetInput(), input::limit);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/14
-    std::println("Day 14, 2015: Reindeer Olympics");
+    puzzle.Title(2015, 14, "Reindeer Olympics");
 
 #ifndef NDEBUG
     auto const deers = ParseDeers(example::text);
@@ -126,11 +126,15 @@ int main()
     Assert(689 == GetWinnerPoints(example::text, 1000));
 #endif
 
-    int const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(2660 == part1);
+    puzzle.Part(1, 2660,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(1256 == part2);
+    puzzle.Part(2, 1256,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,13 +1,13 @@
 #include "day15.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/utils.hpp"
 
 #include <array>
 #include <fstream>
 #include <numeric>
-#include <print>
 #include <utility>
 #include <vector>
 
@@ -46,7 +46,7 @@ struct Ingredient
 {
     std::vector<Ingredient> ingredients;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         auto const parts = Split(line, ' ');
 
@@ -160,16 +160,22 @@ static std::pair<int, int> Run()
     return std::make_pair(maxScore, maxScore500);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/15
-    std::println("Day 15, 2015: Science for Hungry People");
+    puzzle.Title(2015, 15, "Science for Hungry People");
 
     Tests();
 
-    auto const [part1, part2] = Run();
-    std::println("  Part 1: {}", part1);
-    Assert(21'367'368 == part1);
-    std::println("  Part 2: {}", part2);
-    Assert(1'766'400 == part2);
+    puzzle.Part(1, 21'367'368,
+        []
+        {
+            return Run().first;
+        });
+
+    puzzle.Part(2, 1'766'400,
+        []
+        {
+            return Run().second;
+        });
 }
@@ -1,10 +1,10 @@
 #include "day16.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <map>
-#include <print>
 
 using Aunt = std::map<std::string, int>;
 
@@ -20,7 +20,7 @@ static Aunt ParseMFCSAM(std::string_view text)
 {
     Aunt result;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         ParseValue(result, line);
     }
@@ -35,7 +35,7 @@ static Aunt ParseAunt(std::string_view text)
     auto name = text.substr(0, firstColon);
     result["name"] = svtoi(name.substr(name.find(' ') + 1));
 
-    for (auto const &v : Split(text.substr(firstColon + 1), ','))
+    for (auto const &v : Fields(text.substr(firstColon + 1), ','))
     {
         ParseValue(result, v);
     }
@@ -47,7 +47,7 @@ static std::vector<Aunt> ParseAunts(std::string_view text)
 {
     std::vector<Aunt> aunts;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         aunts.emplace_back(ParseAunt(line));
     }
@@ -124,16 +124,20 @@ static int Part2()
         });
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/16
-    std::println("Day 16, 2015: Aunt Sue");
+    puzzle.Title(2015, 16, "Aunt Sue");
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(40 == part1);
+    puzzle.Part(1, 40,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(241 == part2);
+    puzzle.Part(2, 241,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,11 +1,10 @@
 #include "day17.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/utils.hpp"
 
-#include <print>
-
 static auto HowManyCombinationsCanFit(std::vector<int> const &input, int limit)
 {
     int nbCombinationsTotal = 0;
@@ -50,7 +49,7 @@ static auto Parts()
 {
     std::vector<int> containers;
 
-    for (auto &&line : Split(GetInput(), '\n'))
+    for (auto &&line : Lines(GetInput()))
     {
         containers.emplace_back(svtoi(line));
     }
@@ -58,17 +57,22 @@ static auto Parts()
     return HowManyCombinationsCanFit(containers, 150);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/17
-    std::println("Day 17, 2015: No Such Thing as Too Much");
+    puzzle.Title(2015, 17, "No Such Thing as Too Much");
 
     Example();
 
-    auto const [part1, part2] = Parts();
-    std::println("  Part 1: {}", part1);
-    Assert(1304 == part1);
+    puzzle.Part(1, 1304,
+        []
+        {
+            return Parts().first;
+        });
 
-    std::println("  Part 2: {}", part2);
-    Assert(18 == part2);
+    puzzle.Part(2, 18,
+        []
+        {
+            return Parts().second;
+        });
 }
@@ -1,11 +1,11 @@
 #include "day18.hpp"
 
 #include "../cpp-utils/assert.hpp"
-#include "../cpp-utils/string.hpp"
+#include "../cpp-utils/gridview.hpp"
+#include "../cpp-utils/puzzle.hpp"
 
 #include <array>
 #include <numeric>
-#include <print>
 #include <vector>
 
 struct GOL
@@ -48,18 +48,15 @@ struct GOL
 
     void LoadMap(std::string_view mapText)
     {
-        auto const &lines = Split(mapText, '\n');
-        int w = width = static_cast<int>(lines.front().size());
-        int h = height = static_cast<int>(lines.size());
-        map.resize(static_cast<std::size_t>(h * w));
+        GridView const view{mapText};
+        width = view.Width();
+        height = view.Height();
+        map.resize(static_cast<std::size_t>(height * width));
         std::size_t offset = 0;
 
-        for (auto &&line : lines)
+        for (auto p : view.Points())
         {
-            for (char c : line)
-            {
-                map[offset++] = c == '#';
-            }
+            map[offset++] = view[p] == '#';
         }
     }
 
@@ -171,18 +168,22 @@ static int Part2()
     return gameOfLife.GetAliveCount();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/18
-    std::println("Day 18, 2015: Like a GIF For Your Yard");
+    puzzle.Title(2015, 18, "Like a GIF For Your Yard");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(768 == part1);
+    puzzle.Part(1, 768,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(781 == part2);
+    puzzle.Part(2, 781,
+        []
+        {
+            return Part2();
+        });
 }
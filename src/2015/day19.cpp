@@ -1,12 +1,12 @@
 #include "day19.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <algorithm>
 #include <functional>
 #include <map>
-#include <print>
 #include <random>
 #include <set>
 
@@ -35,7 +35,7 @@ int CountMolecules(Grammar const &grammar, std::string_view input)
 Grammar ParseGrammar(std::string_view text)
 {
     Grammar t;
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         auto pos = line.find(" => ");
         t.insert(std::make_pair(line.substr(0, pos), line.substr(pos + 4)));
@@ -46,7 +46,7 @@ Grammar ParseGrammar(std::string_view text)
 
 static auto &GetRNG()
 {
-    static std::mt19937 rng(std::random_device{}());
+    static thread_local std::mt19937 rng(std::random_device{}());
     return rng;
 }
 
@@ -108,10 +108,10 @@ static auto ParseInput()
     return std::make_pair(parts[0], parts[1]);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/19
-    std::println("Day 19, 2015: Medicine for Rudolph");
+    puzzle.Title(2015, 19, "Medicine for Rudolph");
 
     Assert(4 == CountMolecules(ParseGrammar(example::grammar1), example::molecule1));
     Assert(7 == CountMolecules(ParseGrammar(example::grammar1), example::molecule2));
@@ -120,11 +120,15 @@ int main()
 
     auto const [grammar, molecule] = ParseInput();
 
-    auto const part1 = CountMolecules(ParseGrammar(grammar), molecule);
-    std::println("  Part 1: {}", part1);
-    Assert(535 == part1);
+    puzzle.Part(1, 535,
+        [&]
+        {
+            return CountMolecules(ParseGrammar(grammar), molecule);
+        });
 
-    auto const part2 = GetNumberOfSteps(ParseGrammar(grammar), molecule);
-    std::println("  Part 2: {}", part2);
-    Assert(212 == part2);
+    puzzle.Part(2, 212,
+        [&]
+        {
+            return GetNumberOfSteps(ParseGrammar(grammar), molecule);
+        });
 }
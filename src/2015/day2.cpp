@@ -1,10 +1,10 @@
 #include "day2.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <charconv>
-#include <print>
 #include <sstream>
 
 struct Box
@@ -58,21 +58,25 @@ static std::pair<int, int> calculate()
     return {total_area, total_length};
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/2
-    std::println("Day 2, 2015: I Was Told There Would Be No Math");
+    puzzle.Title(2015, 2, "I Was Told There Would Be No Math");
 
     Assert(58 == Box{"2x3x4"}.area());
     Assert(43 == Box{"1x1x10"}.area());
     Assert(34 == Box{"2x3x4"}.length());
     Assert(14 == Box{"1x1x10"}.length());
 
-    auto const [area, length] = calculate();
+    puzzle.Part(1, 1'586'300,
+        []
+        {
+            return calculate().first;
+        });
 
-    std::println("  Part1: {}", area);
-    std::println("  Part2: {}", length);
-
-    Assert(1'586'300 == area);
-    Assert(3'737'498 == length);
+    puzzle.Part(2, 3'737'498,
+        []
+        {
+            return calculate().second;
+        });
 }
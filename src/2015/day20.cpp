@@ -1,9 +1,9 @@
 #include "day20.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <vector>
 
 int Part1(int limit)
@@ -63,21 +63,25 @@ static int ParseInput()
     return svtoi(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/20
-    std::println("Day 20, 2015: Infinite Elves and Infinite Houses");
+    puzzle.Title(2015, 20, "Infinite Elves and Infinite Houses");
 
     Assert(2 == Part1(30));
     Assert(3 == Part1(40));
     Assert(4 == Part1(70));
     Assert(6 == Part1(120));
 
-    auto const part1 = Part1(ParseInput());
-    std::println("  Part 1: {}", part1);
-    Assert(786'240 == part1);
+    puzzle.Part(1, 786'240,
+        []
+        {
+            return Part1(ParseInput());
+        });
 
-    auto const part2 = Part2(ParseInput());
-    std::println("  Part 2: {}", part2);
-    Assert(831'600 == part2);
+    puzzle.Part(2, 831'600,
+        []
+        {
+            return Part2(ParseInput());
+        });
 }
@@ -4,9 +4,9 @@
 #include "game_item.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <vector>
 
 struct Shop
@@ -134,16 +134,20 @@ int RunGame(bool condition, PredT &&pred)
     return *std::min_element(begin(goldSpentPerGame), end(goldSpentPerGame), std::forward<PredT>(pred));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/21
-    std::println("Day 21, 2015: RPG Simulator 20XX");
+    puzzle.Title(2015, 21, "RPG Simulator 20XX");
 
-    auto const part1 = RunGame(true, std::less<int>{});
-    std::println("  Part 1: {}", part1);
-    Assert(121 == part1);
+    puzzle.Part(1, 121,
+        []
+        {
+            return RunGame(true, std::less<int>{});
+        });
 
-    auto const part2 = RunGame(false, std::greater<int>{});
-    std::println("  Part 2: {}", part2);
-    Assert(201 == part2);
+    puzzle.Part(2, 201,
+        []
+        {
+            return RunGame(false, std::greater<int>{});
+        });
 }
@@ -3,11 +3,11 @@
 #include "game_character.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <map>
 #include <optional>
-#include <print>
 #include <vector>
 
 static int GetIntAfter(std::string_view text, std::string_view search)
@@ -249,18 +249,22 @@ static int Part2()
     return g.Play(true);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/22
-    std::println("Day 22, 2015: Wizard Simulator 20XX");
+    puzzle.Title(2015, 22, "Wizard Simulator 20XX");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(1824 == part1);
+    puzzle.Part(1, 1824,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(1937 == part2);
+    puzzle.Part(2, 1937,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,9 +1,9 @@
 #include "day23.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <span>
 
 struct VM
@@ -131,18 +131,22 @@ auto Part2()
     return vm.b;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/23
-    std::println("Day 23, 2015: Opening the Turing Lock");
+    puzzle.Title(2015, 23, "Opening the Turing Lock");
 
     Assert(2 == Example());
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(170 == part1);
+    puzzle.Part(1, 170,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(247 == part2);
+    puzzle.Part(2, 247,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,6 +1,7 @@
 #include "day24.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/utils.hpp"
 
@@ -71,29 +72,26 @@ int64_t GetBestFit(std::span<int const> numbers, int nbPackages)
 
 static std::vector<int> ParseInput()
 {
-    std::vector<int> numbers;
-
-    for (auto number : Split(GetInput(), '\n'))
-    {
-        numbers.push_back(svtoi(number));
-    }
-
-    return numbers;
+    return ParseIntegers(GetInput(), '\n');
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/24
-    std::println("Day 24, 2015: It Hangs in the Balance");
+    puzzle.Title(2015, 24, "It Hangs in the Balance");
 
     Assert(99 == GetBestFit(example::numbers, 3));
     Assert(44 == GetBestFit(example::numbers, 4));
 
-    auto const part1 = GetBestFit(ParseInput(), 3);
-    std::println("  Part 1: {}", part1);
-    Assert(11'266'889'531 == part1);
+    puzzle.Part(1, 11'266'889'531,
+        []
+        {
+            return GetBestFit(ParseInput(), 3);
+        });
 
-    auto const part2 = GetBestFit(ParseInput(), 4);
-    std::println("  Part 2: {}", part2);
-    Assert(77'387'711 == part2);
+    puzzle.Part(2, 77'387'711,
+        []
+        {
+            return GetBestFit(ParseInput(), 4);
+        });
 }
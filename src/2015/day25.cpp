@@ -1,10 +1,9 @@
 #include "day25.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
-
 [[maybe_unused]] static int64_t GetNextSimple(int64_t n, bool first)
 {
     if (first)
@@ -60,10 +59,10 @@ static std::pair<int, int> ParseInput()
     return std::make_pair(column, row);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/25
-    std::println("Day 25, 2015: Let It Snow");
+    puzzle.Title(2015, 25, "Let It Snow");
 
     Assert(1 == GetValue(1, 1, &GetNextSimple));
     Assert(3 == GetValue(2, 1, &GetNextSimple));
@@ -108,8 +107,10 @@ int main()
     Assert(17'552'253 == GetValue(2, 5, &GetNext));
     Assert(33'071'741 == GetValue(1, 6, &GetNext));
 
-    auto const [column, row] = ParseInput();
-    auto const part1 = GetValue(column, row, &GetNext);
-    std::println("  Part 1: {}", part1);
-    Assert(9'132'360 == part1);
+    puzzle.Part(1, 9'132'360,
+        []
+        {
+            auto const [column, row] = ParseInput();
+            return GetValue(column, row, &GetNext);
+        });
 }
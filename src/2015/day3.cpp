@@ -2,9 +2,9 @@
 
 #include "../cpp-utils/assert.hpp"
 #include "../cpp-utils/point2d.hpp"
+#include "../cpp-utils/puzzle.hpp"
 
 #include <map>
-#include <print>
 #include <vector>
 
 class HouseVisitor
@@ -77,20 +77,24 @@ static int GetNbVisitedHouses(std::string_view path, int playerCount)
     return houseVisitor.GetVisitedHouses();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/3
-    std::println("Day 3, 2015: Perfectly Spherical Houses in a Vacuum");
+    puzzle.Title(2015, 3, "Perfectly Spherical Houses in a Vacuum");
 
     Assert(2 == GetNbVisitedHouses(">", 1));
     Assert(4 == GetNbVisitedHouses("^>v<", 1));
     Assert(2 == GetNbVisitedHouses("^v^v^v^v^v", 1));
 
-    int const part1 = GetNbVisitedHouses(GetInput(), 1);
-    std::println("  Part 1: {}", part1);
-    Assert(2572 == part1);
+    puzzle.Part(1, 2572,
+        []
+        {
+            return GetNbVisitedHouses(GetInput(), 1);
+        });
 
-    int const part2 = GetNbVisitedHouses(GetInput(), 2);
-    std::println("  Part 2: {}", part2);
-    Assert(2631 == part2);
+    puzzle.Part(2, 2631,
+        []
+        {
+            return GetNbVisitedHouses(GetInput(), 2);
+        });
 }
@@ -2,10 +2,10 @@
 
 #include "../cpp-utils/assert.hpp"
 #include "../cpp-utils/md5.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <array>
-#include <print>
 #include <vector>
 
 static std::string MineOne(std::string const &key, int n)
@@ -26,16 +26,20 @@ static int Mine(std::string const &key, std::string_view start)
     }
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/4
-    std::println("Day 4, 2015: The Ideal Stocking Stuffer");
+    puzzle.Title(2015, 4, "The Ideal Stocking Stuffer");
 
-    int const part1 = Mine(std::string{GetInput()}, "00000");
-    std::println("  Part1: {}", part1);
-    Assert(117'946 == part1);
+    puzzle.Part(1, 117'946,
+        []
+        {
+            return Mine(std::string{GetInput()}, "00000");
+        });
 
-    int const part2 = Mine(std::string{GetInput()}, "000000");
-    std::println("  Part2: {}", part2);
-    Assert(3'938'038 == part2);
+    puzzle.Part(2, 3'938'038,
+        []
+        {
+            return Mine(std::string{GetInput()}, "000000");
+        });
 }
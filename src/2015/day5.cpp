@@ -1,11 +1,11 @@
 #include "day5.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <array>
 #include <map>
-#include <print>
 #include <utility>
 
 static bool IsNice1(std::string_view text)
@@ -67,7 +67,7 @@ static int Part1()
 {
     int count = 0;
 
-    for (auto const &line : Split(GetInput(), '\n'))
+    for (auto const &line : Lines(GetInput()))
     {
         if (IsNice1(line))
         {
@@ -134,7 +134,7 @@ static int Part2()
 {
     int count = 0;
 
-    for (auto const &line : Split(GetInput(), '\n'))
+    for (auto const &line : Lines(GetInput()))
     {
         if (IsNice2(line))
         {
@@ -145,10 +145,10 @@ static int Part2()
     return count;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/5
-    std::println("Day 5, 2015: Doesn't He Have Intern-Elves For This?");
+    puzzle.Title(2015, 5, "Doesn't He Have Intern-Elves For This?");
 
     Assert(IsNice1("ugknbfddgicrmopn"));
     Assert(IsNice1("aaa"));
@@ -160,11 +160,15 @@ int main()
     Assert(!IsNice2("uurcxstgmygtbstg"));
     Assert(!IsNice2("ieodomkazucvgmuy"));
 
-    int const part1 = Part1();
-    std::println("  Part1: {}", part1);
-    Assert(238 == part1);
+    puzzle.Part(1, 238,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part2: {}", part2);
-    Assert(69 == part2);
+    puzzle.Part(2, 69,
+        []
+        {
+            return Part2();
+        });
 }
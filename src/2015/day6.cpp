@@ -1,6 +1,7 @@
 #include "day6.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <array>
@@ -128,7 +129,7 @@ public:
 
     void ParseInstructions1(std::string_view instructions)
     {
-        for (auto const &line : Split(instructions, '\n'))
+        for (auto const &line : Lines(instructions))
         {
             ParseLine1(line);
         }
@@ -136,7 +137,7 @@ public:
 
     void ParseInstructions2(std::string_view instructions)
     {
-        for (auto const &line : Split(instructions, '\n'))
+        for (auto const &line : Lines(instructions))
         {
             ParseLine2(line);
         }
@@ -184,16 +185,20 @@ static int Part2()
     return grid.TotalBrightness();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/6
-    std::println("Day 6, 2015: Probably a Fire Hazard");
+    puzzle.Title(2015, 6, "Probably a Fire Hazard");
 
-    int const part1 = Part1();
-    std::println("  Part1: {}", part1);
-    Assert(569'999 == part1);
+    puzzle.Part(1, 569'999,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part2: {}", part2);
-    Assert(17'836'115 == part2);
+    puzzle.Part(2, 17'836'115,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,137 +1,195 @@
 #include "day7.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/dag.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <functional>
-#include <map>
-#include <print>
-#include <string>
-#include <variant>
+#include <cctype>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
+// a wire or a signal
+struct Operand
+{
+    bool wire = false;
+    std::uint32_t value = 0;
+};
+
+struct Gate
+{
+    enum class Op
+    {
+        None,
+        Set,
+        Not,
+        And,
+        Or,
+        LShift,
+        RShift,
+    };
+
+    Op op = Op::None;
+    Operand left;
+    Operand right;
+};
+
+// the gates by the ids of the wires they output to, evaluated in one pass once sorted
 class Circuit
 {
-    std::map<std::string, std::function<unsigned short()>> wires;
-    std::map<std::string, unsigned short> cache;
+    Interner names;
+    std::vector<Gate> gates;
+    Dag dag;
+    std::vector<unsigned short> values;
 
-    std::function<unsigned short()> Resolve(std::string_view text)
+    Operand Resolve(std::string_view text)
     {
         if (std::isdigit(text[0]) != 0)
         {
-            return [n = svtoi(text)]()
+            return {false, static_cast<std::uint32_t>(svtoi(text))};
+        }
+
+        return {true, names.Intern(text)};
+    }
+
+    void Connect(std::string_view out, Gate gate)
+    {
+        auto const wire = names.Intern(out);
+        dag.Resize(names.Size());
+
+        // replaces the inputs of the gate it had, if any
+        std::vector<std::uint32_t> inputs;
+
+        for (auto const operand : {gate.left, gate.right})
+        {
+            if (operand.wire)
             {
-                return static_cast<unsigned short>(n);
-            };
+                inputs.push_back(operand.value);
+            }
         }
 
-        return [this, n = text]()
+        dag.SetInputs(wire, inputs);
+
+        gates.resize(names.Size());
+        gates[wire] = gate;
+    }
+
+    static unsigned short Signal(Gate const &gate, std::span<unsigned short const> signals)
+    {
+        auto const get = [&](Operand operand)
         {
-            return GetWire(n);
+            return operand.wire ? signals[operand.value] : static_cast<unsigned short>(operand.value);
         };
+
+        switch (gate.op)
+        {
+            case Gate::Op::Set:
+                return get(gate.left);
+            case Gate::Op::Not:
+                return static_cast<unsigned short>(~get(gate.left));
+            case Gate::Op::And:
+                return get(gate.left) & get(gate.right);
+            case Gate::Op::Or:
+                return get(gate.left) | get(gate.right);
+            case Gate::Op::LShift:
+                return static_cast<unsigned short>(get(gate.left) << get(gate.right));
+            case Gate::Op::RShift:
+                return static_cast<unsigned short>(get(gate.left) >> get(gate.right));
+            case Gate::Op::None:
+                break;
+        }
+
+        throw std::runtime_error("Invalid wire");
     }
 
 public:
     explicit Circuit(std::string_view instructions)
     {
-        for (auto const &line : Split(instructions, '\n'))
+        for (auto const &line : Lines(instructions))
         {
             auto parts = Split(line, ' ');
             std::size_t const nb = parts.size();
 
             if (nb == 3)
             {
-                std::string out{parts.back()};
-                auto const &in = parts.front();
-                wires[out] = Resolve(in);
-                // std::println("{} = {}", out, in);
+                Connect(parts.back(), {Gate::Op::Set, Resolve(parts.front()), {}});
             }
             else if (nb == 4)
             {
-                auto const &op = parts[0];
-                std::string out{parts.back()};
-                if (op != "NOT")
+                if (parts[0] != "NOT")
                 {
                     throw std::runtime_error("Unknown instruction");
                 }
 
-                // std::println("{} = NOT {}", out, parts[1]);
-                wires[out] = [val = Resolve(parts[1])]()
-                {
-                    return static_cast<unsigned short>(~val());
-                };
+                Connect(parts.back(), {Gate::Op::Not, Resolve(parts[1]), {}});
             }
             else if (nb == 5)
             {
                 auto const &op = parts[1];
-                std::string out{parts.back()};
-                // std::println("{} = {} {} {}", out, parts[0], parts[1], parts[2]);
+                Gate gate{Gate::Op::None, Resolve(parts[0]), Resolve(parts[2])};
 
                 if (op == "AND")
                 {
-                    wires[out] = [left = Resolve(parts[0]), right = Resolve(parts[2])]() -> unsigned short
-                    {
-                        return left() & right();
-                    };
+                    gate.op = Gate::Op::And;
                 }
                 else if (op == "OR")
                 {
-                    wires[out] = [left = Resolve(parts[0]), right = Resolve(parts[2])]() -> unsigned short
-                    {
-                        return left() | right();
-                    };
+                    gate.op = Gate::Op::Or;
                 }
                 else if (op == "LSHIFT")
                 {
-                    wires[out] = [left = Resolve(parts[0]), right = Resolve(parts[2])]()
-                    {
-                        return static_cast<unsigned short>(left() << right());
-                    };
+                    gate.op = Gate::Op::LShift;
                 }
                 else if (op == "RSHIFT")
                 {
-                    wires[out] = [left = Resolve(parts[0]), right = Resolve(parts[2])]()
-                    {
-                        return static_cast<unsigned short>(left() >> right());
-                    };
+                    gate.op = Gate::Op::RShift;
                 }
                 else
                 {
                     throw std::runtime_error("Unknown instruction");
                 }
+
+                Connect(parts.back(), gate);
             }
         }
+
+        gates.resize(names.Size());
     }
 
     [[nodiscard]] unsigned short GetWire(std::string_view name)
     {
-        std::string key{name};
-        if (auto itCache = cache.find(key); itCache != end(cache))
+        auto const wire = names.Find(name);
+
+        if (not wire)
         {
-            return itCache->second;
+            throw std::runtime_error("Invalid wire");
         }
 
-        auto iter = wires.find(key);
-
-        if (iter == end(wires))
+        if (values.empty())
         {
-            throw std::runtime_error("Invalid wire");
+            values = dag.Evaluate<unsigned short>(
+                [this](std::uint32_t node, std::span<unsigned short const> signals)
+                {
+                    return Signal(gates[node], signals);
+                });
         }
 
-        unsigned short const value = iter->second();
-        // std::println("{} = {}", name, value);
-        cache[key] = value;
-        return value;
+        return values[*wire];
     }
 
-    void SetWire(std::string const &name, unsigned short value)
+    // the wire gets the signal value instead of the output of its gate
+    void SetWire(std::string_view name, unsigned short value)
     {
-        cache[name] = value;
+        Connect(name, {Gate::Op::Set, {false, value}, {}});
+        values.clear();
     }
 
     void Reset()
     {
-        cache.clear();
+        values.clear();
     }
 };
 
@@ -150,10 +208,10 @@ static int Part2()
     return c.GetWire("a");
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/7
-    std::println("Day 7, 2015: Some Assembly Required");
+    puzzle.Title(2015, 7, "Some Assembly Required");
 
 #ifndef NDEBUG
     Circuit c{input::example};
@@ -167,11 +225,15 @@ int main()
     Assert(456 == c.GetWire("y"));
 #endif
 
-    int const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(46'065 == part1);
+    puzzle.Part(1, 46'065,
+        []
+        {
+            return Part1();
+        });
 
-    int const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(14'134 == part2);
+    puzzle.Part(2, 14'134,
+        []
+        {
+            return Part2();
+        });
 }
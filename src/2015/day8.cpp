@@ -1,9 +1,9 @@
 #include "day8.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <string>
 
 static std::string Unescape(std::string_view text)
@@ -83,7 +83,7 @@ static int Part1(std::string_view text)
 {
     std::size_t total = 0;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         total += line.size() - Unescape(line).size();
     }
@@ -95,7 +95,7 @@ static int Part2(std::string_view text)
 {
     std::size_t total = 0;
 
-    for (auto &&line : Split(text, '\n'))
+    for (auto &&line : Lines(text))
     {
         total += Escape(line).size() - line.size();
     }
@@ -103,19 +103,23 @@ static int Part2(std::string_view text)
     return static_cast<int>(total);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/8
-    std::println("Day 8, 2015: Matchsticks");
+    puzzle.Title(2015, 8, "Matchsticks");
 
     Assert(12 == Part1(input::example1));
     Assert(19 == Part2(input::example1));
 
-    int const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(1333 == part1);
+    puzzle.Part(1, 1333,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    int const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(2046 == part2);
+    puzzle.Part(2, 2046,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -1,88 +1,68 @@
 #include "day9.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
-#include "../cpp-utils/utils.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <print>
+#include <tuple>
+#include <vector>
 
-struct Route
+// distances between every two cities, by the ids of their names
+struct Distances
 {
-    std::string a;
-    std::string b;
-    int distance = 0;
+    Interner cities;
+    std::vector<int> matrix;
 
-    static Route Parse(std::string_view line)
+    [[nodiscard]] int Get(std::uint32_t a, std::uint32_t b) const
     {
-        auto parts = Split(line, '=');
-        auto &names = parts[0];
-        auto distanceText = parts[1];
-        trim(names);
-        trim(distanceText);
-        int distance = svtoi(distanceText);
-        auto pos = names.find(" to ");
-        auto a = names.substr(0, pos);
-        auto b = names.substr(pos + 4, names.size());
-
-        if (b < a)
-        {
-            std::swap(a, b);
-        }
-
-        return {std::string{a}, std::string{b}, distance};
+        return matrix[a * cities.Size() + b];
     }
+};
 
-    bool operator==(Route const &other) const
-    {
-        return std::tie(a, b, distance) == std::tie(other.a, other.b, other.distance);
-    }
+static Distances ParseDistances(std::string_view data)
+{
+    Distances distances;
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, int>> routes;
 
-    bool operator!=(Route const &other) const
+    for (auto line : Lines(data))
     {
-        return std::tie(a, b, distance) != std::tie(other.a, other.b, other.distance);
-    }
+        if (line.empty())
+        {
+            continue;
+        }
 
-    bool operator<(Route const &other) const
-    {
-        return std::tie(a, b, distance) < std::tie(other.a, other.b, other.distance);
+        // London to Dublin = 464
+        auto const parts = Split(line, ' ');
+        auto const a = distances.cities.Intern(parts[0]);
+        auto const b = distances.cities.Intern(parts[2]);
+        routes.emplace_back(a, b, svtoi(parts[4]));
+#if DEBUG_PRINT
+        std::println("{} -> {} = {}", parts[0], parts[2], parts[4]);
+#endif
     }
-};
 
-static int FindRoute(std::vector<Route> const &routes, std::string_view a, std::string_view b)
-{
-    auto iter = std::find_if(begin(routes), end(routes),
-        [&](Route const &r)
-        {
-            return (r.a == a && r.b == b) || (r.a == b && r.b == a);
-        });
+    auto const n = distances.cities.Size();
+    distances.matrix.assign(n * n, -1);
 
-    if (iter != end(routes))
+    for (auto const &[a, b, distance] : routes)
     {
-        return iter->distance;
+        distances.matrix[a * n + b] = distance;
+        distances.matrix[b * n + a] = distance;
     }
 
-    return -1;
+    return distances;
 }
 
 template <typename PredicateT>
 static int FindShortest(std::string_view data, PredicateT &&pred)
 {
-    auto lines = Split(data, '\n');
-    std::vector<Route> routes;
-    routes.reserve(lines.size());
-    std::vector<std::string> cities;
-    cities.reserve(lines.size() * 2);
-
-    for (auto &&line : lines)
-    {
-        Route &r = routes.emplace_back(Route::Parse(line));
-#if DEBUG_PRINT
-        std::println("{} -> {} = {}", r.a, r.b, r.distance);
-#endif
-        insert_sorted(cities, r.a);
-        insert_sorted(cities, r.b);
-    }
-
+    auto const distances = ParseDistances(data);
+    std::vector<std::uint32_t> cities(distances.cities.Size());
+    std::iota(begin(cities), end(cities), 0U);
     int best = -1;
 
     do
@@ -92,7 +72,7 @@ static int FindShortest(std::string_view data, PredicateT &&pred)
 
         for (auto iter = std::next(prev); iter != end(cities); ++iter, ++prev)
         {
-            int const dist = FindRoute(routes, *prev, *iter);
+            int const dist = distances.Get(*prev, *iter);
             Assert(dist != -1);
             total += dist;
         }
@@ -103,9 +83,9 @@ static int FindShortest(std::string_view data, PredicateT &&pred)
         }
 
 #if DEBUG_PRINT
-        for (auto &&city : cities)
+        for (auto city : cities)
         {
-            std::print("{} -> ", city);
+            std::print("{} -> ", distances.cities.Name(city));
         }
         std::println("{}", total);
 #endif
@@ -115,19 +95,23 @@ static int FindShortest(std::string_view data, PredicateT &&pred)
     return best;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2015/day/9
-    std::println("Day 9, 2015: All in a Single Night");
+    puzzle.Title(2015, 9, "All in a Single Night");
 
     Assert(605 == FindShortest(input::example, std::less<>{}));
     Assert(982 == FindShortest(input::example, std::greater<>{}));
 
-    int const part1 = FindShortest(GetInput(), std::less<>{});
-    std::println("  Part 1: {}", part1);
-    Assert(117 == part1);
+    puzzle.Part(1, 117,
+        []
+        {
+            return FindShortest(GetInput(), std::less<>{});
+        });
 
-    int const part2 = FindShortest(GetInput(), std::greater<>{});
-    std::println("  Part 2: {}", part2);
-    Assert(909 == part2);
+    puzzle.Part(2, 909,
+        []
+        {
+            return FindShortest(GetInput(), std::greater<>{});
+        });
 }
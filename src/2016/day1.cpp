@@ -1,13 +1,14 @@
 #include "day1.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/flathash.hpp"
 
 static int Part1(std::string_view directions)
 {
     Point2d dir{0, -1};
     Point2d pos{0, 0};
 
-    for (auto d : Split(directions, ", "))
+    for (auto d : Fields(directions, ", "))
     {
         if (d[0] == 'L')
         {
@@ -29,9 +30,9 @@ static int Part2(std::string_view directions)
 {
     Point2d dir{0, -1};
     Point2d pos{0, 0};
-    std::unordered_set<Point2d> visited;
+    FlatHashSet<Point2d> visited;
 
-    for (auto d : Split(directions, ", "))
+    for (auto d : Fields(directions, ", "))
     {
         if (d[0] == 'L')
         {
@@ -60,21 +61,25 @@ static int Part2(std::string_view directions)
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2016/day/1
-    std::println("Day 1, 2016: No Time for a Taxicab");
+    puzzle.Title(2016, 1, "No Time for a Taxicab");
 
     Assert(5 == Part1("R2, L3"));
     Assert(2 == Part1("R2, R2, R2"));
     Assert(12 == Part1("R5, L5, R5, R3"));
     Assert(4 == Part2("R8, R4, R4, R8"));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(271 == part1);
+    puzzle.Part(1, 271,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(153 == part2);
+    puzzle.Part(2, 153,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
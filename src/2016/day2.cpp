@@ -125,7 +125,7 @@ static std::string ParseInstructions(std::string_view insctructions, Keypad cons
     std::string code;
     Point2d cursor = keypad.FindPosition('5').value();
 
-    for (auto line : Split(insctructions, '\n'))
+    for (auto line : Lines(insctructions))
     {
         for (char d : line)
         {
@@ -148,19 +148,23 @@ static std::string Part2()
     return ParseInstructions(GetInput(), Keypad::Parse(keypad2));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2016/day/2
-    std::println("Day 2, 2016: Bathroom Security");
+    puzzle.Title(2016, 2, "Bathroom Security");
 
     Assert("1985" == ParseInstructions(example::instructions, Keypad::Parse(keypad1)));
     Assert("5DB3" == ParseInstructions(example::instructions, Keypad::Parse(keypad2)));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert("36629" == part1);
+    puzzle.Part(1, "36629",
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    // Assert( == part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
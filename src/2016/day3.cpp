@@ -63,19 +63,23 @@ static int Part2()
     return CountVerticalTriangles(ParseTrianglesVerticaly(GetInput()));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2016/day/3
-    std::println("Day 3, 2016: Squares With Three Sides");
+    puzzle.Title(2016, 3, "Squares With Three Sides");
 
     Assert(false == IsTriangleTextValid(example::triangle));
     Assert(6 == CountVerticalTriangles(ParseTrianglesVerticaly(example::triangles2)));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(982 == part1);
+    puzzle.Part(1, 982,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(1826 == part2);
+    puzzle.Part(2, 1826,
+        []
+        {
+            return Part2();
+        });
 }
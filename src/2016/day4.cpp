@@ -150,10 +150,10 @@ static auto Part2()
     return FindSectorIdForRoom(GetInput(), "object"sv);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2016/day/4
-    std::println("Day 4, 2016: Security Through Obscurity");
+    puzzle.Title(2016, 4, "Security Through Obscurity");
 
     Assert(ParseRoom(example::room1).real);
     Assert(ParseRoom(example::room2).real);
@@ -161,11 +161,15 @@ int main()
     Assert(not ParseRoom(example::room4).real);
     Assert("very encrypted name" == ParseRoom(example::room5).Decrypt());
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(137'896 == part1);
+    puzzle.Part(1, 137'896,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(501 == part2);
+    puzzle.Part(2, 501,
+        []
+        {
+            return Part2();
+        });
 }
@@ -36,26 +36,28 @@ static_assert(2 == GetRealFuel(14));
 static_assert(966 == GetRealFuel(1969));
 static_assert(50'346 == GetRealFuel(100'756));
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 1, 2019: The Tyranny of the Rocket Equation");
+    puzzle.Title(2019, 1, "The Tyranny of the Rocket Equation");
     auto const input = ParseInputNumbers();
 
-    int const part1 = std::accumulate(begin(input), end(input), 0,
-        [](int r, int mass)
+    puzzle.Part(1, 3'538'016,
+        [&]
         {
-            return r + GetFuel(mass);
+            return std::accumulate(begin(input), end(input), 0,
+                [](int r, int mass)
+                {
+                    return r + GetFuel(mass);
+                });
         });
 
-    int const part2 = std::accumulate(begin(input), end(input), 0,
-        [](int r, int mass)
+    puzzle.Part(2, 5'304'147,
+        [&]
         {
-            return r + GetRealFuel(mass);
+            return std::accumulate(begin(input), end(input), 0,
+                [](int r, int mass)
+                {
+                    return r + GetRealFuel(mass);
+                });
         });
-
-    std::println("  Part1: {}", part1);
-    Assert(3'538'016 == part1);
-
-    std::println("  Part2: {}", part2);
-    Assert(5'304'147 == part2);
 }
@@ -93,22 +93,14 @@ struct Asteroid
     return {static_cast<int>(best.rays.size()), best.pos};
 }
 
-int main()
+static std::size_t Part1()
 {
-    std::println("Day 10, 2019: Monitoring Station");
-
-    Assert(std::make_pair(8, Point2d{3, 4}) == GetBestFromMap(example::map1));
-    Assert(std::make_pair(33, Point2d{5, 8}) == GetBestFromMap(example::map2));
-    Assert(std::make_pair(35, Point2d{1, 2}) == GetBestFromMap(example::map3));
-    Assert(std::make_pair(41, Point2d{6, 3}) == GetBestFromMap(example::map4));
-    Assert(std::make_pair(210, Point2d{11, 13}) == GetBestFromMap(example::map5));
-
-    auto map = ParseMap(GetInput());
-
-    auto const best = GetAsteroidWithMostRays(map);
-    std::println("  Part1: {}", best.rays.size());
-    Assert(299 == best.rays.size());
+    return GetAsteroidWithMostRays(ParseMap(GetInput())).rays.size();
+}
 
+static int Part2()
+{
+    auto const best = GetAsteroidWithMostRays(ParseMap(GetInput()));
     std::vector<std::pair<Point2d, Ray>> r;
 
     for (auto const &elem : best.rays)
@@ -137,7 +129,28 @@ int main()
     auto const el200 = begin(r) + 199;
     std::nth_element(begin(r), el200, end(r), sortBySlope);
 
-    int const part2 = el200->second.pos.x * 100 + el200->second.pos.y;
-    std::println("  Part2: {}", part2);
-    Assert(1419 == part2);
+    return el200->second.pos.x * 100 + el200->second.pos.y;
+}
+
+void Solve(Puzzle &puzzle)
+{
+    puzzle.Title(2019, 10, "Monitoring Station");
+
+    Assert(std::make_pair(8, Point2d{3, 4}) == GetBestFromMap(example::map1));
+    Assert(std::make_pair(33, Point2d{5, 8}) == GetBestFromMap(example::map2));
+    Assert(std::make_pair(35, Point2d{1, 2}) == GetBestFromMap(example::map3));
+    Assert(std::make_pair(41, Point2d{6, 3}) == GetBestFromMap(example::map4));
+    Assert(std::make_pair(210, Point2d{11, 13}) == GetBestFromMap(example::map5));
+
+    puzzle.Part(1, 299,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, 1419,
+        []
+        {
+            return Part2();
+        });
 }
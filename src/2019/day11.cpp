@@ -1,12 +1,16 @@
 #include "day11.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/grid2d.hpp"
 #include "../cpp-utils/intcode.hpp"
 
 struct Robot
 {
+    // panels never painted, black
+    static constexpr Int kUnpainted = -1;
+
     Point2d pos{0, 0};
-    std::unordered_map<Point2d, Int> grid;
+    Grid2d<Int> grid = Grid2d<Int>::Unbounded(kUnpainted, kUnpainted);
     std::array<Point2d, 4> dirs = {{{0, -1}, {-1, 0}, {0, 1}, {1, 0}}};
     Point2d dir = dirs.front();
     bool paint = true;
@@ -25,13 +29,7 @@ struct Robot
     {
         auto getPanel = [&]() -> Int
         {
-            auto iter = grid.find(pos);
-            if (iter != end(grid))
-            {
-                return iter->second;
-            }
-
-            return 0;
+            return std::max<Int>(grid.Get(pos), 0);
         };
 
         auto readOutput = [&](Int value)
@@ -39,7 +37,7 @@ struct Robot
             if (paint)
             {
                 paint = false;
-                grid[pos] = value;
+                grid.Grow(pos) = value;
             }
             else
             {
@@ -62,52 +60,49 @@ struct Robot
     }
 };
 
-static void Part1()
+static std::size_t Part1()
 {
     Robot robot;
     robot.Run();
-    std::println("  Part1: {}", robot.grid.size());
-    Assert(expected::part1 == robot.grid.size());
+    auto const panels = static_cast<std::size_t>(robot.grid.Width()) * static_cast<std::size_t>(robot.grid.Height());
+    return panels - robot.grid.Count(Robot::kUnpainted);
 }
 
-static void Part2()
+static std::string Part2()
 {
     Robot robot;
-    robot.grid[{0, 0}] = 1;
+    robot.grid.Grow({0, 0}) = 1;
     robot.Run();
 
-    Point2d min;
-    Point2d max;
-
-    for (auto const &elem : robot.grid)
-    {
-        min.x = std::min(min.x, elem.first.x);
-        min.y = std::min(min.y, elem.first.y);
-        max.x = std::max(max.x, elem.first.x);
-        max.y = std::max(max.y, elem.first.y);
-    }
-
     std::string result;
     std::array<std::string_view, 2> lookup = {" ", "█"};
 
-    for (int y = min.y; y <= max.y; ++y)
+    for (auto p : robot.grid.Points())
     {
-        for (int x = min.x; x <= max.x; ++x)
+        result.append(lookup.at(static_cast<std::size_t>(std::max<Int>(robot.grid[p], 0))));
+
+        if (p.x == robot.grid.Max().x)
         {
-            result.append(lookup.at(static_cast<std::size_t>(robot.grid[{x, y}])));
+            result.append("\n");
         }
-
-        result.append("\n");
     }
 
-    std::print("  Part2:\n{}", result);
-    Assert(expected::part2 == result);
+    return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 11, 2019: Space Police");
+    puzzle.Title(2019, 11, "Space Police");
 
-    Part1();
-    Part2();
+    puzzle.Part(1, expected::part1,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, expected::part2,
+        []
+        {
+            return Part2();
+        });
 }
@@ -2,13 +2,14 @@
 
 #include "../cpp-utils/assert.hpp"
 #include "../cpp-utils/combinations.hpp"
+#include "../cpp-utils/extract.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/terminal.hpp"
 
 #include <array>
 #include <numeric>
-#include <print>
-#include <regex>
+#include <tuple>
 
 class Moon
 {
@@ -16,28 +17,25 @@ public:
     std::array<long long, 3> pos{};
     std::array<long long, 3> vel{};
 
-    explicit Moon(std::string const &data)
+    explicit Moon(std::string_view data)
     {
-        std::regex re(R"(<x=(-?\d+), y=(-?\d+), z=(-?\d+)>)");
-        std::smatch m;
+        auto const fields = Extract<"<x={}, y={}, z={}>", long long, long long, long long>(data);
 
-        if (!std::regex_match(data, m, re))
+        if (!fields)
         {
             throw std::invalid_argument("Invalid data");
         }
 
-        pos[0] = std::stoi(m[1]);
-        pos[1] = std::stoi(m[2]);
-        pos[2] = std::stoi(m[3]);
+        std::tie(pos[0], pos[1], pos[2]) = *fields;
     }
 
     static std::vector<Moon> ReadMoons(std::string_view data)
     {
         std::vector<Moon> moons;
 
-        for (auto const &line : Split(data, '\n'))
+        for (auto const &line : Lines(data))
         {
-            moons.emplace_back(std::string{line});
+            moons.emplace_back(line);
         }
 
         return moons;
@@ -157,21 +155,25 @@ static long long CountCycle(std::string_view data)
     return std::lcm(std::lcm(count[0], count[1]), count[2]);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 12, 2019: The N-Body Problem");
+    puzzle.Title(2019, 12, "The N-Body Problem");
 
     Assert(179 == Simulate(example::one, 10));
     Assert(1940 == Simulate(example::two, 100));
 
-    auto part1 = Simulate(GetInput(), 1000);
-    std::println("  Part1: {}", part1);
-    Assert(8625 == part1);
+    puzzle.Part(1, 8625,
+        []
+        {
+            return Simulate(GetInput(), 1000);
+        });
 
     Assert(2772 == CountCycle(example::one));
     Assert(4'686'774'924 == CountCycle(example::two));
 
-    auto part2 = CountCycle(GetInput());
-    std::println("  Part2: {}", part2);
-    Assert(332'477'126'821'644 == part2);
+    puzzle.Part(2, 332'477'126'821'644,
+        []
+        {
+            return CountCycle(GetInput());
+        });
 }
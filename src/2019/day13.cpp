@@ -1,6 +1,7 @@
 #include "day13.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/grid2d.hpp"
 #include "../cpp-utils/intcode.hpp"
 
 enum class Tile
@@ -12,10 +13,30 @@ enum class Tile
     Ball,   // The ball moves diagonally and bounces off objects.
 };
 
-static void Part1()
+// the outputs go by three, x, y and tile
+template <typename SetXT, typename SetYT, typename SetTileT>
+static void OnOutput(int &field, Int value, SetXT &setX, SetYT &setY, SetTileT &setTile)
+{
+    switch (field)
+    {
+        case 0:
+            setX(value);
+            break;
+        case 1:
+            setY(value);
+            break;
+        default:
+            setTile(value);
+            break;
+    }
+
+    field = (field + 1) % 3;
+}
+
+static std::ptrdiff_t Part1()
 {
     Point2d pos;
-    std::unordered_map<Point2d, Tile> grid;
+    auto grid = Grid2d<Tile>::Unbounded(Tile::Empty, Tile::Empty);
 
     auto setX = [&](Int value)
     {
@@ -29,26 +50,18 @@ static void Part1()
 
     auto setTitle = [&](Int value)
     {
-        grid[pos] = static_cast<Tile>(value);
+        grid.Grow(pos) = static_cast<Tile>(value);
     };
 
-    std::array<std::function<void(Int)>, 3> states = {setX, setY, setTitle};
+    int field = 0;
 
     Intcode::Run(ParseInputNumbers<Int, ','>(), nullptr,
         [&](Int value)
         {
-            states.front()(value);
-            std::rotate(begin(states), begin(states) + 1, end(states));
+            OnOutput(field, value, setX, setY, setTitle);
         });
 
-    auto result = std::count_if(begin(grid), end(grid),
-        [](auto const &elem)
-        {
-            return elem.second == Tile::Block;
-        });
-
-    std::println("  Part1: {}", result);
-    Assert(expected::part1 == result);
+    return static_cast<std::ptrdiff_t>(grid.Count(Tile::Block));
 }
 
 static std::string GetTile(Tile tile)
@@ -68,32 +81,26 @@ static std::string GetTile(Tile tile)
     }
 }
 
-static void Part2(bool render)
+static Int Part2(bool render)
 {
     Intcode cpu(ParseInputNumbers<Int, ','>());
     cpu.WriteMemory(0, 2);
 
     Point2d inputPos;
-    std::unordered_map<Point2d, Tile> grid;
+    auto grid = Grid2d<Tile>::Unbounded(Tile::Empty, Tile::Empty);
     Int score = 0;
     Point2d ballPos;
     Point2d paddlePos;
     Int nextInput = 0;
-    Point2d min;
-    Point2d max;
 
     auto setX = [&](Int value)
     {
         inputPos.x = static_cast<int>(value);
-        min.x = std::min(min.x, inputPos.x);
-        max.x = std::max(max.x, inputPos.x);
     };
 
     auto setY = [&](Int value)
     {
         inputPos.y = static_cast<int>(value);
-        min.y = std::min(min.y, inputPos.y);
-        max.y = std::max(max.y, inputPos.y);
     };
 
     auto setTitle = [&](Int value)
@@ -134,31 +141,27 @@ static void Part2(bool render)
                 std::print(CSI("{};{}H") "{}", inputPos.y + 1, inputPos.x + 1, GetTile(tile));
             }
 
-            grid[inputPos] = tile;
+            grid.Grow(inputPos) = tile;
         }
     };
 
-    cpu.SetInput(
-        [&]()
-        {
-            return std::exchange(nextInput, 0);
-        });
-
-    std::array<std::function<void(Int)>, 3> states = {setX, setY, setTitle};
-    cpu.SetOutput(
-        [&](Int value)
-        {
-            states.front()(value);
-            std::rotate(begin(states), begin(states) + 1, end(states));
-        });
-
     if (render)
     {
         // Switches to a new alternate screen buffer.
         std::print(CSI("?1049h") CSI("?25l"));
     }
 
-    cpu.Run();
+    int field = 0;
+
+    cpu.Run(
+        [&]()
+        {
+            return std::exchange(nextInput, 0);
+        },
+        [&](Int value)
+        {
+            OnOutput(field, value, setX, setY, setTitle);
+        });
 
     if (render)
     {
@@ -166,18 +169,22 @@ static void Part2(bool render)
         std::print(CSI("?1049l") CSI("?25h"));
     }
 
-    std::println("  Part2: {}", score);
-    Assert(expected::part2 == score);
+    return score;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    bool const isTerminal = IsTerminal(stdout);
-    std::println("Day 13, 2019: Care Package");
+    puzzle.Title(2019, 13, "Care Package");
 
-    Part1();
+    puzzle.Part(1, expected::part1,
+        []
+        {
+            return Part1();
+        });
 
-    // NOLINTNEXTLINE: cppcoreguidelines-pro-bounds-pointer-arithmetic
-    bool const render = isTerminal;
-    Part2(render);
+    puzzle.Part(2, expected::part2,
+        [&puzzle]
+        {
+            return Part2(puzzle.IsInteractive());
+        });
 }
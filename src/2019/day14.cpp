@@ -1,16 +1,20 @@
 #include "day14.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/dag.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/terminal.hpp"
 
-#include <map>
-#include <print>
+#include <ranges>
+#include <utility>
+#include <vector>
 
 struct Elem
 {
     std::uint64_t count = 0;
-    std::string name;
+    std::string_view name;
 
     static Elem Parse(std::string_view data)
     {
@@ -25,109 +29,105 @@ struct Elem
 
 struct NanoFactory
 {
-    std::map<std::string, std::pair<Elem, std::vector<Elem>>> reactions;
-    std::map<std::string, std::uint64_t> storage;
+    struct Reaction
+    {
+        std::uint64_t count = 0;
+        std::vector<std::pair<std::uint32_t, std::uint64_t>> composants;
+    };
+
+    // by the ids of the names of the chemicals
+    Interner chemicals;
+    std::uint32_t ore = chemicals.Intern("ORE");
+    std::uint32_t fuel = chemicals.Intern("FUEL");
+    std::vector<Reaction> reactions;
+
+    // every chemical after its composants
+    Dag dag;
 
     static NanoFactory Parse(std::string_view data)
     {
         NanoFactory f;
 
-        for (auto const &line : Split(data, '\n'))
+        for (auto const &line : Lines(data))
         {
+            if (line.empty())
+            {
+                continue;
+            }
+
             auto pos = line.find("=>");
             auto left = line.substr(0, pos);
             trim(left);
 
-            std::vector<Elem> composants;
+            Reaction reaction;
 
-            for (auto &c : Split(left, ','))
+            for (auto c : Fields(left, ','))
             {
                 trim(c);
-                composants.push_back(Elem::Parse(c));
+                auto const composant = Elem::Parse(c);
+                reaction.composants.emplace_back(f.chemicals.Intern(composant.name), composant.count);
             }
 
             auto right = line.substr(pos + 2);
             trim(right);
-            auto result = Elem::Parse(right);
-
-            f.reactions[result.name] = std::make_pair(result, std::move(composants));
-        }
-
-        return f;
-    }
-
-    bool Produce(std::string const &name, std::uint64_t count = 1)
-    {
-        if (storage[name] >= count)
-        {
-            return true;
-        }
-
-        if (name == "ORE")
-        {
-            return false;
-        }
-
-        auto const &[result, composants] = reactions[name];
-        auto n = static_cast<std::uint64_t>(
-            ceil((static_cast<double>(count) - static_cast<double>(storage[name])) / static_cast<double>(result.count)));
-#if 0
-        std::println("{} = {} - {} / {}", n, count, storage[name], result.count);
-#endif
+            auto const result = Elem::Parse(right);
+            reaction.count = result.count;
 
-        bool producing = true;
+            auto const id = f.chemicals.Intern(result.name);
 
-        for (auto const &c : composants)
-        {
-            producing &= Produce(c.name, n * c.count);
-            storage[c.name] -= std::min(storage[c.name], n * c.count);
-        }
+            for (auto const &[composant, count] : reaction.composants)
+            {
+                f.dag.AddInput(id, composant);
+            }
 
-        if (producing)
-        {
-            storage[name] += n * result.count;
-            return true;
+            f.reactions.resize(f.chemicals.Size());
+            f.reactions[id] = std::move(reaction);
         }
 
-        return false;
+        f.reactions.resize(f.chemicals.Size());
+        f.dag.Resize(f.chemicals.Size());
+        return f;
     }
 
-    std::uint64_t ComputeOre()
+    // ORE needed for count FUEL: the needs go from the fuel down to the ore, each chemical
+    // being produced once all the reactions that use it are known
+    std::uint64_t ComputeOre(std::uint64_t count = 1)
     {
-        std::uint64_t low = 0;
-        std::uint64_t high = std::numeric_limits<std::uint64_t>::max();
+        std::vector<std::uint64_t> needs(chemicals.Size());
+        needs[fuel] = count;
+        auto const order = dag.Order();
 
-        while (low < high)
+        for (auto const chemical : std::views::reverse(order))
         {
-            std::uint64_t pivot = low + (high - low) / 2;
-            storage.clear();
-            storage["ORE"] = pivot;
+            auto const &[resultCount, composants] = reactions[chemical];
 
-            if (Produce("FUEL"))
+            if (chemical == ore || needs[chemical] == 0)
             {
-                high = pivot;
+                continue;
             }
-            else
+
+            auto const n = (needs[chemical] + resultCount - 1) / resultCount;
+
+            for (auto const &[composant, composantCount] : composants)
             {
-                low = pivot + 1;
+                needs[composant] += n * composantCount;
             }
         }
 
-        return low;
+        return needs[ore];
     }
 
+    // most FUEL produced with totalOre ORE
     std::uint64_t ComputeFuel(std::uint64_t totalOre = 1'000'000'000'000)
     {
         std::uint64_t low = 0;
         std::uint64_t high = totalOre;
 
-        while (low < high - 1)
+        while (low < high)
         {
-            std::uint64_t pivot = low + (high - low) / 2;
-            storage.clear();
-            storage["ORE"] = totalOre;
+            std::uint64_t const pivot = low + (high - low + 1) / 2;
 
-            if (Produce("FUEL", pivot))
+            if (ComputeOre(pivot) <= totalOre)
             {
                 low = pivot;
             }
@@ -137,18 +137,13 @@ struct NanoFactory
             }
         }
 
-        if (Produce("FUEL", high))
-        {
-            return high;
-        }
-
         return low;
     }
 };
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 14, 2019: Space Stoichiometry");
+    puzzle.Title(2019, 14, "Space Stoichiometry");
 
     Assert(31 == NanoFactory::Parse(example::ex1).ComputeOre());
     Assert(165 == NanoFactory::Parse(example::ex2).ComputeOre());
@@ -160,11 +155,15 @@ int main()
     Assert(5'586'022 == NanoFactory::Parse(example::ex4).ComputeFuel());
     Assert(460'664 == NanoFactory::Parse(example::ex5).ComputeFuel());
 
-    auto const part1 = NanoFactory::Parse(GetInput()).ComputeOre();
-    std::println("  Part1: {}", part1);
-    Assert(1'967'319 == part1);
+    puzzle.Part(1, 1'967'319,
+        []
+        {
+            return NanoFactory::Parse(GetInput()).ComputeOre();
+        });
 
-    auto const part2 = NanoFactory::Parse(GetInput()).ComputeFuel();
-    std::println("  Part2: {}", part2);
-    Assert(1'122'036 == part2);
+    puzzle.Part(2, 1'122'036,
+        []
+        {
+            return NanoFactory::Parse(GetInput()).ComputeFuel();
+        });
 }
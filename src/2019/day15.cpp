@@ -1,11 +1,12 @@
 #include "day15.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/bfs.hpp"
+#include "../cpp-utils/grid2d.hpp"
 #include "../cpp-utils/intcode.hpp"
 
 #include <chrono>
 #include <optional>
-#include <set>
 #include <thread>
 
 static constexpr std::string_view kWall{"█"};
@@ -13,12 +14,13 @@ static constexpr std::string_view kFloor{"."};
 static constexpr std::string_view kDroid{"@"};
 static constexpr std::string_view kOxygen{"O"};
 static constexpr std::string_view kStart{"S"};
+static constexpr std::string_view kUnknown{" "};
 
 struct Robot
 {
     Intcode cpu;
     Point2d pos;
-    std::unordered_map<Point2d, std::string_view> grid;
+    Grid2d<std::string_view> grid = Grid2d<std::string_view>::Unbounded(kUnknown, kUnknown);
     static constexpr std::array<Point2d, 4> dirs{{{0, -1}, {0, +1}, {-1, 0}, {+1, 0}}};
     std::optional<Point2d> oxygen;
 
@@ -36,7 +38,7 @@ struct Robot
     {
         grid[pos] = kFloor;
         pos = std::get<Point2d>(backup);
-        grid[pos] = kDroid;
+        grid.Grow(pos) = kDroid;
         cpu.Restore(std::get<Intcode::State>(backup));
     }
 
@@ -58,47 +60,30 @@ struct Robot
 
         if (*r != 0)
         {
-            grid[pos] = kFloor;
-            grid[p] = kDroid;
+            grid.Grow(pos) = kFloor;
+            grid.Grow(p) = kDroid;
             pos = p;
         }
         else
         {
-            grid[p] = kWall;
+            grid.Grow(p) = kWall;
         }
 
         return *r;
     }
 
-    [[nodiscard]] std::pair<Point2d, Point2d> GetBounds() const
-    {
-        std::pair<Point2d, Point2d> bounds{{std::numeric_limits<int>::max(), std::numeric_limits<int>::max()},
-            {std::numeric_limits<int>::min(), std::numeric_limits<int>::min()}};
-
-        for (auto const &elem : grid)
-        {
-            bounds.first.x = std::min(bounds.first.x, elem.first.x);
-            bounds.first.y = std::min(bounds.first.y, elem.first.y);
-            bounds.second.x = std::max(bounds.second.x, elem.first.x);
-            bounds.second.y = std::max(bounds.second.y, elem.first.y);
-        }
-
-        return bounds;
-    }
-
     void PrintFrame() const
     {
-        auto const bounds = GetBounds();
         std::string frame;
 
-        for (int y = bounds.first.y; y <= bounds.second.y; ++y)
+        for (auto p : grid.Points())
         {
-            for (int x = bounds.first.x; x <= bounds.second.x; ++x)
+            frame.append(grid[p]);
+
+            if (p.x == grid.Max().x)
             {
-                frame.append(GetTile({x, y}));
+                frame.append("\n");
             }
-
-            frame.append("\n");
         }
 
         std::print("{}", frame);
@@ -113,7 +98,7 @@ struct Robot
 
         if (GetTile({0, 0}) != kDroid)
         {
-            grid[{0, 0}] = kStart;
+            grid.Grow({0, 0}) = kStart;
         }
 
         PrintFrame();
@@ -128,13 +113,7 @@ struct Robot
 
     [[nodiscard]] std::string_view GetTile(Point2d p) const
     {
-        auto iter = grid.find(p);
-        if (iter != end(grid))
-        {
-            return iter->second;
-        }
-
-        return {" "};
+        return grid.Get(p);
     }
 
     [[nodiscard]] std::vector<int> GetChoices() const
@@ -143,7 +122,7 @@ struct Robot
 
         for (int i = 0; i != 4; ++i)
         {
-            if (grid.find(GetNextPos(i)) == end(grid))
+            if (GetTile(GetNextPos(i)) == kUnknown)
             {
                 choices.push_back(i);
             }
@@ -190,139 +169,52 @@ struct Robot
         }
     }
 
-    bool RecursiveSolve(Point2d p, std::set<Point2d> &visited, std::vector<Point2d> &path,
-        std::pair<Point2d, Point2d> const &bounds) const
-    {
-        if (p == *oxygen)
-        {
-            path.push_back(p);
-            return true;
-        }
-
-        if (GetTile(p) == kWall || visited.find(p) != end(visited))
-        {
-            return false;
-        }
-
-        visited.insert(p);
-        auto const &[min, max] = bounds;
-
-        if (p.x != min.x)
-        {
-            if (RecursiveSolve({p.x - 1, p.y}, visited, path, bounds))
-            {
-                path.push_back(p);
-                return true;
-            }
-        }
-
-        if (p.x != max.x)
-        {
-            if (RecursiveSolve({p.x + 1, p.y}, visited, path, bounds))
-            {
-                path.push_back(p);
-                return true;
-            }
-        }
-
-        if (p.y != min.y)
-        {
-            if (RecursiveSolve({p.x, p.y - 1}, visited, path, bounds))
-            {
-                path.push_back(p);
-                return true;
-            }
-        }
-
-        if (p.y != max.y)
-        {
-            if (RecursiveSolve({p.x, p.y + 1}, visited, path, bounds))
-            {
-                path.push_back(p);
-                return true;
-            }
-        }
-
-        return false;
-    }
-
-    [[nodiscard]] std::vector<Point2d> Solve() const
+    // steps from the oxygen system to every explored cell, -1 for the walls
+    [[nodiscard]] Grid2d<int> OxygenDistances() const
     {
-        std::set<Point2d> visited;
-        std::vector<Point2d> path;
-        [[maybe_unused]] bool const solved = RecursiveSolve({0, 0}, visited, path, GetBounds());
-        Assert(solved);
-        return path;
-    }
+        std::array const sources{*oxygen};
 
-    [[nodiscard]] bool IsFilling() const
-    {
-        return std::any_of(begin(grid), end(grid),
-            [](auto const &elem)
+        return DistanceMap(grid.Min(), grid.Max(), sources,
+            [this](Point2d p, auto &&visit)
             {
-                return elem.second == kFloor;
+                for (auto dir : dirs)
+                {
+                    if (auto const tile = GetTile(p + dir); tile != kWall && tile != kUnknown)
+                    {
+                        visit(p + dir);
+                    }
+                }
             });
     }
+};
 
-    std::vector<Point2d> FindCandidates()
-    {
-        std::vector<Point2d> candidates;
+void Solve(Puzzle &puzzle)
+{
+    puzzle.Title(2019, 15, "Oxygen System");
 
-        for (auto const &cell : grid)
+    puzzle.Part(1, 254,
+        []
         {
-            if (cell.second != kOxygen)
-            {
-                continue;
-            }
-
-            for (std::size_t d = 0; d != 4; ++d)
-            {
-                auto p = cell.first + dirs.at(d);
-
-                if (GetTile(p) == kFloor)
-                {
-                    candidates.push_back(p);
-                }
-            }
-        }
+            Robot r;
+            r.ExploreAll();
+            // r.Print();
+            return r.OxygenDistances()[{0, 0}];
+        });
 
-        return candidates;
-    }
-
-    int FillOxygen()
-    {
-        int count = 0;
-
-        while (IsFilling())
+    puzzle.Part(2, 268,
+        []
         {
-            ++count;
+            // the time the oxygen takes to reach the farthest cell
+            Robot r;
+            r.ExploreAll();
+            auto const distances = r.OxygenDistances();
+            int farthest = 0;
 
-            for (auto c : FindCandidates())
+            for (auto p : distances.Points())
             {
-                grid[c] = kOxygen;
+                farthest = std::max(farthest, distances[p]);
             }
-        }
-
-        return count;
-    }
-};
-
-int main()
-{
-    [[maybe_unused]] bool const isTerminal = IsTerminal(stdout);
-
-    std::println("Day 15, 2019: Oxygen System");
-
-    Robot r;
-    r.ExploreAll();
-
-    // r.Print();
-
-    auto const commands = r.Solve();
-    std::println("  Part1: {} commands", commands.size() - 1);
-    Assert(254 == commands.size() - 1);
 
-    auto const part2 = r.FillOxygen();
-    std::println("  Part2: {} minutes", part2);
-    Assert(268 == part2);
+            return farthest;
+        });
 }
@@ -1,12 +1,12 @@
 #include "day16.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/terminal.hpp"
 
 #include <algorithm>
 #include <array>
 #include <fstream>
-#include <print>
 #include <string>
 #ifdef COROUTINE
 #include <experimental/generator>
@@ -158,9 +158,9 @@ static std::string ProcessWithOffsetTimes10000(std::string_view numbers, int cou
     return {ret.begin() + r.rem, ret.begin() + r.rem + 8};
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 16, 2019: Flawed Frequency Transmission");
+    puzzle.Title(2019, 16, "Flawed Frequency Transmission");
 
     Assert("48226158" == Process("12345678", 1));
     Assert("34040438" == Process("12345678", 2));
@@ -174,11 +174,15 @@ int main()
     Assert("78725270" == ProcessWithOffsetTimes10000("02935109699940807407585447034323", 100));
     Assert("53553731" == ProcessWithOffsetTimes10000("03081770884921959731165446850517", 100));
 
-    auto const part1 = Process(GetInput(), 100);
-    std::println("  Part1: {}", part1);
-    Assert("88323090" == part1);
+    puzzle.Part(1, "88323090",
+        []
+        {
+            return Process(GetInput(), 100);
+        });
 
-    auto const part2 = ProcessWithOffsetTimes10000(GetInput(), 100);
-    std::println("  Part2: {}", part2);
-    Assert("50077964" == part2);
+    puzzle.Part(2, "50077964",
+        []
+        {
+            return ProcessWithOffsetTimes10000(GetInput(), 100);
+        });
 }
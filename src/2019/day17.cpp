@@ -251,15 +251,13 @@ static void FillPath(std::string &path, Map const &map, Pos start, Pos dir)
     return path;
 }
 
-static void Part1()
+static Int Part1()
 {
     auto m = GenerateMap();
-    auto const part1 = MarkIntersections(m);
-    std::println("  Part1: {}", part1);
-    Assert(14'332 == part1);
+    return MarkIntersections(m);
 }
 
-static void Part2()
+static Int Part2()
 {
     constexpr bool debug = false;
 
@@ -267,15 +265,18 @@ static void Part2()
     cpu.WriteMemory(0, 2);
     Int result = 0;
 
+    std::string ret;
+    Int prev = 0;
+
     if constexpr (debug)
     {
         auto m = GenerateMap();
         std::string path = GetPath(m);
+    }
 
-        std::string ret;
-        Int prev = 0;
-
-        auto outDebug = [&](Int value)
+    auto out = [&](Int value)
+    {
+        if constexpr (debug)
         {
             if (value > 0x7f)
             {
@@ -296,37 +297,28 @@ static void Part2()
             }
 
             prev = value;
-        };
-
-        cpu.SetOutput(outDebug);
-    }
-    else
-    {
-        cpu.SetOutput(
-            [&](Int value)
-            {
-                result = value;
-            });
-    }
-
-    auto sendInputs = [&cpu](std::string sequence)
-    {
-        while (!sequence.empty())
+        }
+        else
         {
-            cpu.RunUntilInput()(sequence.front());
-            sequence.erase(begin(sequence));
+            result = value;
         }
     };
 
-    sendInputs("A,B,A,B,C,C,B,C,B,A\n");
-    sendInputs("R,12,L,8,R,12\n");
-    sendInputs("R,8,R,6,R,6,R,8\n");
-    sendInputs("R,8,L,8,R,8,R,4,R,4\n");
-    sendInputs("n\n");
-    cpu.Run();
+    std::string_view const inputs{"A,B,A,B,C,C,B,C,B,A\n"
+                                  "R,12,L,8,R,12\n"
+                                  "R,8,R,6,R,6,R,8\n"
+                                  "R,8,L,8,R,8,R,4,R,4\n"
+                                  "n\n"};
+    std::size_t next = 0;
+
+    cpu.Run(
+        [&]()
+        {
+            return Int{inputs.at(next++)};
+        },
+        out);
 
-    std::println("  Part2: {}", result);
-    Assert(1'034'009 == result);
+    return result;
 }
 
 Map ParseMap(std::string_view mapData)
@@ -336,13 +328,22 @@ Map ParseMap(std::string_view mapData)
     return map;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 17, 2019: Set and Forget");
+    puzzle.Title(2019, 17, "Set and Forget");
     Assert(13 == GetMapWidth(example::map1));
     Assert(76 == MarkIntersections(ParseMap(example::map1)));
     Assert("R,8,R,8,R,4,R,4,R,8,L,6,L,2,R,4,R,4,R,8,R,8,R,8,L,6,L,2" == GetPath(ParseMap(example::map2)));
 
-    Part1();
-    Part2();
+    puzzle.Part(1, 14'332,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, 1'034'009,
+        []
+        {
+            return Part2();
+        });
 }
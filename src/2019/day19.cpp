@@ -3,7 +3,7 @@
 #include "../cpp-utils.hpp"
 #include "../cpp-utils/intcode.hpp"
 
-static void Part1()
+static Int Part1()
 {
     Int total = 0;
     std::string beam;
@@ -29,7 +29,8 @@ static void Part1()
         return std::exchange(a, b);
     };
 
-    std::vector<Int> const code = ParseInputNumbers<Int, ','>();
+    // every run shares the pages of the program
+    Intcode::Memory const image{ParseInputNumbers<Int, ','>()};
 
     for (Int y = 0; y != 50; ++y)
     {
@@ -38,22 +39,21 @@ static void Part1()
         for (Int x = 0; x != 50; ++x)
         {
             a = x;
-            Intcode::Run(code, in, out);
+            Intcode::Run(image, in, out);
         }
 
         beam.append(1, '\n');
     }
 
-    std::println("  Part1: {}", total);
-    Assert(231 == total);
-
     if constexpr (false)
     {
         std::println("{}", beam);
     }
+
+    return total;
 }
 
-static Int Run(std::vector<Int> const &code, Int x, Int y)
+static Int Run(Intcode::Memory const &image, Int x, Int y)
 {
     auto in = [&]()
     {
@@ -66,27 +66,27 @@ static Int Run(std::vector<Int> const &code, Int x, Int y)
         result = value;
     };
 
-    Intcode::Run(code, in, out);
+    Intcode::Run(image, in, out);
     return result;
 }
 
 static Int FindSquare(Int width, Int height)
 {
-    std::vector<Int> const code = ParseInputNumbers<Int, ','>();
+    Intcode::Memory const image{ParseInputNumbers<Int, ','>()};
     Int minx = 0;
     Int miny = 10;
 
     for (;; ++miny)
     {
         // trouve le depart
-        while (Run(code, minx, miny) == 0)
+        while (Run(image, minx, miny) == 0)
         {
             ++minx;
         }
 
         for (Int x = 1; x != width; ++x)
         {
-            if (Run(code, x + minx, miny) == 0)
+            if (Run(image, x + minx, miny) == 0)
             {
                 goto next;
             }
@@ -94,7 +94,7 @@ static Int FindSquare(Int width, Int height)
 
         for (Int y = 1; y != height; ++y)
         {
-            if (Run(code, minx, miny - (height - y)) == 0)
+            if (Run(image, minx, miny - (height - y)) == 0)
             {
                 goto next;
             }
@@ -102,7 +102,7 @@ static Int FindSquare(Int width, Int height)
 
         for (Int x = 1; x != width; ++x)
         {
-            if (Run(code, minx + (width - x), miny - (height - 1)) == 0)
+            if (Run(image, minx + (width - x), miny - (height - 1)) == 0)
             {
                 goto next;
             }
@@ -119,16 +119,19 @@ static Int FindSquare(Int width, Int height)
     return x * 10'000 + y;
 }
 
-static void Part2()
+void Solve(Puzzle &puzzle)
 {
-    auto const part2 = FindSquare(100, 100);
-    std::println("  Part2: {}", part2);
-    Assert(9'210'745 == part2);
-}
+    puzzle.Title(2019, 19, "Tractor Beam");
 
-int main()
-{
-    std::println("Day 19, 2019: Tractor Beam");
-    Part1();
-    Part2();
+    puzzle.Part(1, 231,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, 9'210'745,
+        []
+        {
+            return FindSquare(100, 100);
+        });
 }
@@ -41,21 +41,25 @@ Int Part2(std::vector<Int> const &code)
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2019/day/2
-    std::println("Day 2, 2019: 1202 Program Alarm");
+    puzzle.Title(2019, 2, "1202 Program Alarm");
 
     Assert(2 == RunAndGetValue({1, 0, 0, 0, 99}, 0));
     Assert(6 == RunAndGetValue({2, 3, 0, 3, 99}, 3));
     Assert(9801 == RunAndGetValue({2, 4, 4, 5, 99, 0}, 5));
     Assert(30 == RunAndGetValue({1, 1, 1, 4, 99, 5, 6, 0, 99}, 0));
 
-    auto const part1 = Part1(ParseInputNumbers<Int, ','>());
-    std::println("  Part1: {}", part1);
-    Assert(3'706'713 == part1);
+    puzzle.Part(1, 3'706'713,
+        []
+        {
+            return Part1(ParseInputNumbers<Int, ','>());
+        });
 
-    auto const part2 = Part2(ParseInputNumbers<Int, ','>());
-    std::println("  Part2: {}", part2);
-    Assert(8609 == part2);
+    puzzle.Part(2, 8609,
+        []
+        {
+            return Part2(ParseInputNumbers<Int, ','>());
+        });
 }
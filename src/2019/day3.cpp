@@ -4,7 +4,6 @@
 
 #include <algorithm>
 #include <map>
-#include <print>
 #include <string>
 #include <vector>
 
@@ -67,7 +66,7 @@ static Result Solve(std::string_view wire1, std::string_view wire2)
     {
         int length = 0;
         Point2d pos;
-        for (auto const &action : Split(wire1, ','))
+        for (auto const &action : Fields(wire1, ','))
         {
             Run(action, 0b01, pos, length, grid);
         }
@@ -76,7 +75,7 @@ static Result Solve(std::string_view wire1, std::string_view wire2)
     {
         int length = 0;
         Point2d pos;
-        for (auto const &action : Split(wire2, ','))
+        for (auto const &action : Fields(wire2, ','))
         {
             Run(action, 0b10, pos, length, grid);
         }
@@ -115,19 +114,25 @@ static auto ParseInput()
     return std::make_pair(lines[0], lines[1]);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 3, 2019: Crossed Wires");
+    puzzle.Title(2019, 3, "Crossed Wires");
     Assert((Result{6, 30} == Solve("R8,U5,L5,D3", "U7,R6,D4,L4")));
     Assert((Result{159, 610} == Solve("R75,D30,R83,U83,L12,D49,R71,U7,L72", "U62,R66,U55,R34,D71,R55,D58,R83")));
     Assert((Result{135, 410}
         == Solve("R98,U47,R26,D63,R33,U87,L62,D20,R33,U53,R51", "U98,R91,D20,R16,D67,R40,U7,R15,U6,R7")));
 
-    auto const [wire1, wire2] = ParseInput();
-    auto const [closest, fastest] = Solve(wire1, wire2);
-    std::println("  Part1: {}", closest);
-    Assert(245 == closest);
+    puzzle.Part(1, 245,
+        []
+        {
+            auto const [wire1, wire2] = ParseInput();
+            return Solve(wire1, wire2).Dist;
+        });
 
-    std::println("  Part2: {}", fastest);
-    Assert(48'262 == fastest);
+    puzzle.Part(2, 48'262,
+        []
+        {
+            auto const [wire1, wire2] = ParseInput();
+            return Solve(wire1, wire2).Length;
+        });
 }
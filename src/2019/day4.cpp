@@ -67,29 +67,8 @@ static auto ParseInput()
     return std::make_pair(svtoi<unsigned int>(parts[0]), svtoi<unsigned int>(parts[1]));
 }
 
-int main()
+static std::pair<std::size_t, std::size_t> CountPasswords()
 {
-    std::println("Day 4, 2019: Secure Container");
-
-    Assert(IsIncreasing(111'123));
-    Assert(IsIncreasing(135'679));
-
-    Assert(IsValid1(111'111));
-    Assert(!IsValid1(223'450));
-    Assert(!IsValid1(123'789));
-    Assert(IsValid2(112'233));
-    Assert(!IsValid2(123'444));
-    Assert(IsValid2(111'122));
-
-    static_assert(HasDoubleDigit(111'111));
-    static_assert(HasDoubleDigit(112'233));
-    static_assert(HasDoubleDigit(123'444));
-    static_assert(HasDoubleDigit(111'122));
-    static_assert(!HasDoubleDigitExact(111'111));
-    static_assert(HasDoubleDigitExact(112'233));
-    static_assert(!HasDoubleDigitExact(123'444));
-    static_assert(HasDoubleDigitExact(111'122));
-
     std::vector<unsigned int> loose;
     std::vector<unsigned int> strict;
     auto const [begin, end] = ParseInput();
@@ -114,9 +93,41 @@ int main()
         loose.push_back(i);
     }
 
-    std::println("  Part1: {}", loose.size());
-    Assert(1169 == loose.size());
+    return {loose.size(), strict.size()};
+}
+
+void Solve(Puzzle &puzzle)
+{
+    puzzle.Title(2019, 4, "Secure Container");
 
-    std::println("  Part2: {}", strict.size());
-    Assert(757 == strict.size());
+    Assert(IsIncreasing(111'123));
+    Assert(IsIncreasing(135'679));
+
+    Assert(IsValid1(111'111));
+    Assert(!IsValid1(223'450));
+    Assert(!IsValid1(123'789));
+    Assert(IsValid2(112'233));
+    Assert(!IsValid2(123'444));
+    Assert(IsValid2(111'122));
+
+    static_assert(HasDoubleDigit(111'111));
+    static_assert(HasDoubleDigit(112'233));
+    static_assert(HasDoubleDigit(123'444));
+    static_assert(HasDoubleDigit(111'122));
+    static_assert(!HasDoubleDigitExact(111'111));
+    static_assert(HasDoubleDigitExact(112'233));
+    static_assert(!HasDoubleDigitExact(123'444));
+    static_assert(HasDoubleDigitExact(111'122));
+
+    puzzle.Part(1, 1169,
+        []
+        {
+            return CountPasswords().first;
+        });
+
+    puzzle.Part(2, 757,
+        []
+        {
+            return CountPasswords().second;
+        });
 }
@@ -3,7 +3,7 @@
 #include "../cpp-utils.hpp"
 #include "../cpp-utils/intcode.hpp"
 
-[[maybe_unused]] static Int Run(std::vector<Int> const &code, Int input)
+static Int Run(std::vector<Int> const &code, Int input)
 {
     Int outValue = 0;
     Intcode::Run(
@@ -19,40 +19,9 @@
     return outValue;
 }
 
-static void Part1(std::vector<Int> const &code)
+void Solve(Puzzle &puzzle)
 {
-    Intcode::Run(
-        code,
-        []()
-        {
-            return 1;
-        },
-        [](Int value)
-        {
-            std::println("  Part1: {}", value);
-            // 0 is outputed
-            Assert(value == 0 || 13'285'749 == value);
-        });
-}
-
-static void Part2(std::vector<Int> const &code)
-{
-    Intcode::Run(
-        code,
-        []()
-        {
-            return 5;
-        },
-        [](Int value)
-        {
-            std::println("  Part2: {}", value);
-            Assert(5'000'972 == value);
-        });
-}
-
-int main()
-{
-    std::println("Day 5, 2019: Sunny with a Chance of Asteroids");
+    puzzle.Title(2019, 5, "Sunny with a Chance of Asteroids");
 
     Assert(0 == Run({3, 9, 8, 9, 10, 9, 4, 9, 99, -1, 8}, 7));
     Assert(1 == Run({3, 9, 8, 9, 10, 9, 4, 9, 99, -1, 8}, 8));
@@ -89,7 +58,16 @@ int main()
                    125, 20, 4, 20, 1105, 1, 46, 104, 999, 1105, 1, 46, 1101, 1000, 1, 20, 4, 20, 1105, 1, 46, 98, 99},
             9));
 
-    auto const code = ParseInputNumbers<Int, ','>();
-    Part1(code);
-    Part2(code);
+    // the diagnostic tests output 0 before the actual code
+    puzzle.Part(1, 13'285'749,
+        []
+        {
+            return Run(ParseInputNumbers<Int, ','>(), 1);
+        });
+
+    puzzle.Part(2, 5'000'972,
+        []
+        {
+            return Run(ParseInputNumbers<Int, ','>(), 5);
+        });
 }
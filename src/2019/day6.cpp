@@ -1,113 +1,133 @@
 #include "day6.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 #include "../cpp-utils/terminal.hpp"
 
-#include <algorithm>
-#include <map>
-#include <print>
-#include <string>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
-static std::map<std::string, int> countCache; // NOLINT
-
-static int CountIndirect(std::vector<std::string_view> const &list, std::string_view name)
+// the object each object orbits, by the ids of their names
+struct Orbits
 {
-    if (name == "COM")
+    Interner objects;
+    std::vector<std::uint32_t> centers;
+    std::uint32_t com = 0;
+
+    [[nodiscard]] std::uint32_t Id(std::string_view name) const
     {
-        return 0;
-    }
+        auto const id = objects.Find(name);
 
-    std::string const key{name};
+        if (not id.has_value())
+        {
+            throw std::invalid_argument{"Not found"};
+        }
 
-    if (auto iter = countCache.find(key); iter != end(countCache))
-    {
-        return iter->second;
+        return *id;
     }
+};
 
-    for (auto const &item : list)
-    {
-        auto parts = Split(item, ')');
+static Orbits ParseOrbits(std::string_view text)
+{
+    Orbits orbits;
+    orbits.com = orbits.objects.Intern("COM");
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
 
-        if (parts[1] == name)
+    for (auto line : Lines(text))
+    {
+        if (not line.empty())
         {
-            int ret = 1 + CountIndirect(list, parts[0]);
-            countCache[key] = ret;
-            return ret;
+            auto const parts = Split(line, ')');
+            auto const center = orbits.objects.Intern(parts[0]);
+            pairs.emplace_back(center, orbits.objects.Intern(parts[1]));
         }
     }
 
-    throw std::invalid_argument{"Not found"};
-}
-
-static std::map<std::string, std::vector<std::string>> pathCache; // NOLINT
+    orbits.centers.assign(orbits.objects.Size(), orbits.com);
 
-static std::vector<std::string> GetPath(std::vector<std::string_view> const &list, std::string_view name)
-{
-    if (name == "COM")
+    for (auto const &[center, object] : pairs)
     {
-        return {};
+        orbits.centers[object] = center;
     }
 
-    std::string const key{name};
+    return orbits;
+}
 
-    if (auto iter = pathCache.find(key); iter != end(pathCache))
-    {
-        return iter->second;
-    }
+// direct and indirect orbits of every object, each chain walked once
+static std::vector<int> CountOrbits(Orbits const &orbits)
+{
+    std::vector<int> counts(orbits.centers.size(), -1);
+    std::vector<std::uint32_t> chain;
+    counts[orbits.com] = 0;
 
-    for (auto const &item : list)
+    for (std::uint32_t id = 0; id != counts.size(); ++id)
     {
-        auto parts = Split(item, ')');
+        auto center = id;
 
-        if (parts[1] == name)
+        while (counts[center] < 0)
         {
-            auto ret = GetPath(list, parts[0]);
-            ret.emplace_back(parts[0]);
-            pathCache[key] = ret;
-            return ret;
+            chain.push_back(center);
+            center = orbits.centers[center];
+        }
+
+        for (int count = counts[center]; not chain.empty(); chain.pop_back())
+        {
+            counts[chain.back()] = ++count;
         }
     }
 
-    throw std::invalid_argument{"Not found"};
+    return counts;
 }
 
-int main()
+static int CountIndirect(std::string_view text, std::string_view name)
 {
-    std::println("Day 6, 2019: Universal Orbit Map");
-    Assert(3 == CountIndirect(Split(example::data, '\n'), "D"));
-    Assert(7 == CountIndirect(Split(example::data, '\n'), "L"));
-    Assert(0 == CountIndirect(Split(example::data, '\n'), "COM"));
-
-    pathCache.clear();
-    countCache.clear();
-    auto const list = Split(GetInput(), '\n');
+    auto const orbits = ParseOrbits(text);
+    return CountOrbits(orbits)[orbits.Id(name)];
+}
 
-    int count = 0;
+// orbital transfers between the objects orbited by a and b
+static int CountTransfers(Orbits const &orbits, std::string_view a, std::string_view b)
+{
+    auto const counts = CountOrbits(orbits);
+    std::vector<char> aroundA(orbits.centers.size());
 
-    for (auto const &item : list)
+    for (auto id = orbits.Id(a); id != orbits.com; id = orbits.centers[id])
     {
-        auto last = Split(item, ')')[1];
-        count += CountIndirect(list, last);
+        aroundA[orbits.centers[id]] = 1;
     }
 
-    std::println("  Part1: {}", count);
-    Assert(247'089 == count);
+    auto common = orbits.centers[orbits.Id(b)];
 
-    auto you = GetPath(list, "YOU");
-    auto san = GetPath(list, "SAN");
+    while (not aroundA[common])
+    {
+        common = orbits.centers[common];
+    }
 
-    std::sort(begin(you), end(you));
-    std::sort(begin(san), end(san));
+    return counts[orbits.Id(a)] + counts[orbits.Id(b)] - 2 * (counts[common] + 1);
+}
 
-    std::vector<std::string> result;
-    std::set_symmetric_difference(begin(you), end(you), begin(san), end(san), std::back_inserter(result),
-        [](auto const &a, auto const &b)
+void Solve(Puzzle &puzzle)
+{
+    puzzle.Title(2019, 6, "Universal Orbit Map");
+    Assert(3 == CountIndirect(example::data, "D"));
+    Assert(7 == CountIndirect(example::data, "L"));
+    Assert(0 == CountIndirect(example::data, "COM"));
+    Assert(4 == CountTransfers(ParseOrbits(example::data), "YOU", "SAN"));
+
+    puzzle.Part(1, 247'089,
+        []
         {
-            return a < b;
+            auto const counts = CountOrbits(ParseOrbits(GetInput()));
+            return std::reduce(begin(counts), end(counts));
         });
 
-    std::println("  Part2: {}", result.size());
-    Assert(442 == result.size());
+    puzzle.Part(2, 442,
+        []
+        {
+            return CountTransfers(ParseOrbits(GetInput()), "YOU", "SAN");
+        });
 }
@@ -2,6 +2,7 @@
 
 #include "../cpp-utils.hpp"
 #include "../cpp-utils/intcode.hpp"
+#include "../cpp-utils/intcodenetwork.hpp"
 
 static Int Amplify1(std::vector<Int> const &code, std::array<Int, 5> const &sequence)
 {
@@ -33,7 +34,7 @@ static Int Amplify1(std::vector<Int> const &code, std::array<Int, 5> const &sequ
     return param;
 }
 
-static void Part1()
+static Int Part1()
 {
     std::vector<Int> const code = ParseInputNumbers<Int, ','>();
     std::array<Int, 5> sequence{0, 1, 2, 3, 4};
@@ -45,56 +46,35 @@ static void Part1()
     }
     while (std::next_permutation(begin(sequence), end(sequence)));
 
-    std::println("  Part1: {}", maxValue);
-    Assert(30'940 == maxValue);
+    return maxValue;
 }
 
 static Int Amplify2(std::vector<Int> const &code, std::array<Int, 5> const &sequence)
 {
-    Int param = 0;
-
-    std::array cpus{Intcode{code}, Intcode{code}, Intcode{code}, Intcode{code}, Intcode{code}};
+    // each amplifier reads the output of the previous one, the first one reads the last
+    // one
+    IntcodeNetwork network;
 
-    for (size_t i = 0; i != 5; ++i)
+    for (std::size_t i = 0; i != 5; ++i)
     {
-        bool first = true;
-
-        auto in = [&]()
-        {
-            if (first)
-            {
-                first = false;
-                return sequence.at(i);
-            }
-
-            return param;
-        };
-
-        param = *cpus.at(i).RunUntilOuput(in);
+        network.Add(Intcode{code});
+        network.Input(i).TryPush(sequence[i]);
     }
 
-    auto getParam = [&]()
-    {
-        return param;
-    };
-
-    while (!cpus[4].IsHalted())
+    for (std::size_t i = 0; i != 5; ++i)
     {
-        for (auto &cpu : cpus)
-        {
-            auto v = cpu.RunUntilOuput(getParam);
-
-            if (v.has_value())
-            {
-                param = *v;
-            }
-        }
+        network.Connect(i, (i + 1) % 5);
     }
 
+    network.Input(0).TryPush(0);
+    network.Run();
+
+    Int param = 0;
+    network.Input(0).TryPop(param);
     return param;
 }
 
-static void Part2()
+static Int Part2()
 {
     std::vector<Int> const code = ParseInputNumbers<Int, ','>();
     std::array<Int, 5> sequence{5, 6, 7, 8, 9};
@@ -106,13 +86,12 @@ static void Part2()
     }
     while (std::next_permutation(begin(sequence), end(sequence)));
 
-    std::println("  Part2: {}", maxValue);
-    Assert(76'211'147 == maxValue);
+    return maxValue;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 7, 2019: Amplification Circuit");
+    puzzle.Title(2019, 7, "Amplification Circuit");
 
     Assert(example::N1::result == Amplify1(example::N1::code, example::N1::sequence));
     Assert(example::N2::result == Amplify1(example::N2::code, example::N2::sequence));
@@ -120,6 +99,15 @@ int main()
     Assert(example::N4::result == Amplify2(example::N4::code, example::N4::sequence));
     Assert(example::N5::result == Amplify2(example::N5::code, example::N5::sequence));
 
-    Part1();
-    Part2();
+    puzzle.Part(1, 30'940,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, 76'211'147,
+        []
+        {
+            return Part2();
+        });
 }
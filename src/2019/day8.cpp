@@ -60,7 +60,7 @@ static std::string Render(std::string_view pixels, size_t w, size_t h)
 static constexpr size_t W = 25;
 static constexpr size_t H = 6;
 
-static void Part1()
+static int Part1()
 {
     auto layers = DecodeLayers(GetInput(), W, H);
 
@@ -71,11 +71,10 @@ static void Part1()
         });
 
     Assert(iterMin != end(layers));
-    std::println("  Part1: {}", iterMin->count[1] * iterMin->count[2]);
-    Assert(2080 == iterMin->count[1] * iterMin->count[2]);
+    return iterMin->count[1] * iterMin->count[2];
 }
 
-static void Part2()
+static std::string Part2()
 {
     auto const canvas = Render(GetInput(), W, H);
     std::string result;
@@ -99,15 +98,23 @@ static void Part2()
         result.append("\n");
     }
 
-    std::print("  Part2:\n{}", result);
-    Assert(expected::part2 == result);
+    return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 8, 2019: Space Image Format");
+    puzzle.Title(2019, 8, "Space Image Format");
     Assert("0110" == Render("0222112222120000", 2, 2));
 
-    Part1();
-    Part2();
+    puzzle.Part(1, 2080,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, expected::part2,
+        []
+        {
+            return Part2();
+        });
 }
@@ -21,20 +21,24 @@ static std::vector<Int> Run(std::vector<Int> code, Int input = 0)
     return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
-    std::println("Day 9, 2019: Sensor Boost");
+    puzzle.Title(2019, 9, "Sensor Boost");
 
     Assert((std::vector<Int>{109, 1, 204, -1, 1001, 100, 1, 100, 1008, 100, 16, 101, 1006, 101, 0, 99}
         == Run({109, 1, 204, -1, 1001, 100, 1, 100, 1008, 100, 16, 101, 1006, 101, 0, 99})));
     Assert(std::vector<Int>{1'219'070'632'396'864} == Run({1102, 34'915'192, 34'915'192, 7, 4, 7, 99, 0}));
     Assert(std::vector<Int>{1'125'899'906'842'624} == Run({104, 1'125'899'906'842'624, 99}));
 
-    auto const part1 = Run(ParseInputNumbers<Int, ','>(), 1).front();
-    std::println("  Part1: {}", part1);
-    Assert(2'890'527'621 == part1);
-
-    auto const part2 = Run(ParseInputNumbers<Int, ','>(), 2).front();
-    std::println("  Part2: {}", part2);
-    Assert(66'772 == part2);
+    puzzle.Part(1, 2'890'527'621,
+        []
+        {
+            return Run(ParseInputNumbers<Int, ','>(), 1).front();
+        });
+
+    puzzle.Part(2, 66'772,
+        []
+        {
+            return Run(ParseInputNumbers<Int, ','>(), 2).front();
+        });
 }
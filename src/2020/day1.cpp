@@ -38,18 +38,22 @@ static int Part2()
     return Find(ParseInputNumbers(), 3);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/1
-    std::println("Day 1, 2020: Report Repair");
+    puzzle.Title(2020, 1, "Report Repair");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(806'656 == part1);
+    puzzle.Part(1, 806'656,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(230'608'320 == part2);
+    puzzle.Part(2, 230'608'320,
+        []
+        {
+            return Part2();
+        });
 }
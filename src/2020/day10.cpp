@@ -73,18 +73,22 @@ static int64_t Part2(std::vector<int> adapters)
     return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/10
-    std::println("Day 10, 2020: Adapter Array");
+    puzzle.Title(2020, 10, "Adapter Array");
     Assert(35 == Part1({begin(example::adapters1), end(example::adapters1)}));
     Assert(220 == Part1({begin(example::adapters2), end(example::adapters2)}));
 
-    auto const part1 = Part1(ParseInputNumbers());
-    std::println("  Part 1: {}", part1);
-    Assert(2059 == part1);
+    puzzle.Part(1, 2059,
+        []
+        {
+            return Part1(ParseInputNumbers());
+        });
 
-    auto const part2 = Part2(ParseInputNumbers());
-    std::println("  Part 2: {}", part2);
-    Assert(86'812'553'324'672 == part2);
+    puzzle.Part(2, 86'812'553'324'672,
+        []
+        {
+            return Part2(ParseInputNumbers());
+        });
 }
@@ -1,10 +1,10 @@
 #include "day11.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <array>
-#include <print>
 
 struct Grid
 {
@@ -206,18 +206,22 @@ static int Part2()
     return g.TotalOccupiedCount();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/11
-    std::println("Day 11, 2020: Seating System");
+    puzzle.Title(2020, 11, "Seating System");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(2273 == part1);
+    puzzle.Part(1, 2273,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2064 == part2);
+    puzzle.Part(2, 2064,
+        []
+        {
+            return Part2();
+        });
 }
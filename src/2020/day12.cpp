@@ -2,9 +2,9 @@
 
 #include "../cpp-utils/assert.hpp"
 #include "../cpp-utils/point2d.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 
 struct Ship
 {
@@ -101,7 +101,7 @@ struct Ship
 
     Ship &Execute(std::string_view instructions)
     {
-        for (auto &&line : Split(instructions, "\n"))
+        for (auto &&line : Lines(instructions))
         {
             Step(line);
         }
@@ -129,19 +129,23 @@ static int Part2()
     return s.Distance();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/12
-    std::println("Day 12, 2020: Rain Risk");
+    puzzle.Title(2020, 12, "Rain Risk");
 
     Assert(25 == Ship{}.Execute(example::instructions).Distance());
     Assert(286 == Ship{true}.Execute(example::instructions).Distance());
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(1032 == part1);
+    puzzle.Part(1, 1032,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(156'735 == part2);
+    puzzle.Part(2, 156'735,
+        []
+        {
+            return Part2();
+        });
 }
@@ -20,7 +20,7 @@ static int Part1()
     int bestId = 0;
     auto const ticket = ParseInput();
 
-    for (auto &&idText : Split(ticket.busIds, ','))
+    for (auto &&idText : Fields(ticket.busIds, ','))
     {
         if (idText == "x")
         {
@@ -56,7 +56,7 @@ static int64_t GetNextStart(Ticket const &ticket)
     // fortement inspiré de cette solution: https://github.com/colinodell/advent-2020/blob/main/day13/day13.go
     std::vector<int> offsets;
 
-    for (auto &&idText : Split(ticket.busIds, ','))
+    for (auto &&idText : Fields(ticket.busIds, ','))
     {
         if (idText == "x")
         {
@@ -101,10 +101,10 @@ static int64_t Part2()
     return GetNextStart(ParseInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/13
-    std::println("Day 13, 2020: Shuttle Search");
+    puzzle.Title(2020, 13, "Shuttle Search");
 
     Assert(3417 == GetNextStart({0, "17,x,13,19"}));
     Assert(754'018 == GetNextStart({0, "67,7,59,61"}));
@@ -112,11 +112,15 @@ int main()
     Assert(1'261'476 == GetNextStart({0, "67,7,x,59,61"}));
     Assert(1'202'161'486 == GetNextStart({0, "1789,37,47,1889"}));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(261 == part1);
+    puzzle.Part(1, 261,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(807'435'693'182'510 == part2);
+    puzzle.Part(2, 807'435'693'182'510,
+        []
+        {
+            return Part2();
+        });
 }
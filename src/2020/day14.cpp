@@ -120,7 +120,7 @@ struct VM
 static uint64_t Part1()
 {
     VM vm;
-    for (auto &&ins : Split(GetInput(), '\n'))
+    for (auto &&ins : Lines(GetInput()))
     {
         vm.RunInstruction(ins);
     }
@@ -131,7 +131,7 @@ static uint64_t Part1()
 static uint64_t Part2()
 {
     VM vm;
-    for (auto &&ins : Split(GetInput(), '\n'))
+    for (auto &&ins : Lines(GetInput()))
     {
         vm.RunInstruction2(ins);
     }
@@ -152,18 +152,22 @@ static void Example()
 #endif
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/14
-    std::println("Day 14, 2020: Docking Data");
+    puzzle.Title(2020, 14, "Docking Data");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(8'471'403'462'063 == part1);
+    puzzle.Part(1, 8'471'403'462'063,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2'667'858'637'669 == part2);
+    puzzle.Part(2, 2'667'858'637'669,
+        []
+        {
+            return Part2();
+        });
 }
@@ -52,10 +52,10 @@ struct Game
     }
 };
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/15
-    std::println("Day 15, 2020: Rambunctious Recitation");
+    puzzle.Title(2020, 15, "Rambunctious Recitation");
 
     Assert((1 == Game{std::vector{1, 3, 2}}.GetTurn(2020)));
     Assert((10 == Game{std::vector{2, 1, 3}}.GetTurn(2020)));
@@ -64,11 +64,15 @@ int main()
     Assert((438 == Game{std::vector{3, 2, 1}}.GetTurn(2020)));
     Assert((1836 == Game{std::vector{3, 1, 2}}.GetTurn(2020)));
 
-    auto const part1 = Game{ParseInputNumbers<int, ','>()}.GetTurn(2020);
-    std::println("  Part 1: {}", part1);
-    Assert(371 == part1);
+    puzzle.Part(1, 371,
+        []
+        {
+            return Game{ParseInputNumbers<int, ','>()}.GetTurn(2020);
+        });
 
-    auto const part2 = Game{ParseInputNumbers<int, ','>()}.GetTurn(30'000'000);
-    std::println("  Part 2: {}", part2);
-    Assert(352 == part2);
+    puzzle.Part(2, 352,
+        []
+        {
+            return Game{ParseInputNumbers<int, ','>()}.GetTurn(30'000'000);
+        });
 }
@@ -1,8 +1,8 @@
 #include "day16.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/extract.hpp"
 
-#include <regex>
 #include <set>
 
 struct Rule
@@ -14,19 +14,14 @@ struct Rule
 
     Rule(std::string_view text)
     {
-        std::regex re(R"~(([^:]+): (\d+)-(\d+) or (\d+)-(\d+))~");
-        std::match_results<std::string_view::const_iterator> m;
+        auto const fields = Extract<"{}: {}-{} or {}-{}", std::string_view, int, int, int, int>(text);
 
-        if (not std::regex_match(begin(text), end(text), m, re))
+        if (not fields || std::get<0>(*fields).empty())
         {
             throw std::runtime_error{"Invalid rule text"};
         }
 
-        name = std::string_view{&*m[1].first, static_cast<size_t>(m[1].length())};
-        range1.first = svtoi({&*m[2].first, static_cast<size_t>(m[2].length())});
-        range1.second = svtoi({&*m[3].first, static_cast<size_t>(m[3].length())});
-        range2.first = svtoi({&*m[4].first, static_cast<size_t>(m[4].length())});
-        range2.second = svtoi({&*m[5].first, static_cast<size_t>(m[5].length())});
+        std::tie(name, range1.first, range1.second, range2.first, range2.second) = *fields;
     }
 
     [[nodiscard]] bool IsValid(int n) const
@@ -53,7 +48,7 @@ struct Notes
 
     void ParseRules(std::string_view rulesText)
     {
-        for (auto line : Split(rulesText, '\n'))
+        for (auto line : Lines(rulesText))
         {
             rules.emplace_back(line);
         }
@@ -61,14 +56,7 @@ struct Notes
 
     static std::vector<int> ParseNumbers(std::string_view list)
     {
-        std::vector<int> numbers;
-
-        for (auto number : Split(list, ','))
-        {
-            numbers.push_back(svtoi(number));
-        }
-
-        return numbers;
+        return ParseIntegers(list, ',');
     }
 
     void ParseTicket(std::string_view ticket)
@@ -78,7 +66,7 @@ struct Notes
 
     void ParseNearbyTickets(std::string_view tickets)
     {
-        for (auto ticket : Split(tickets, '\n'))
+        for (auto ticket : Lines(tickets))
         {
             nearbyTickets.push_back(ParseNumbers(ticket));
         }
@@ -216,16 +204,20 @@ static int64_t Part2()
     return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/16
-    std::println("Day 16, 2020: Ticket Translation");
+    puzzle.Title(2020, 16, "Ticket Translation");
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(20'060 == part1);
+    puzzle.Part(1, 20'060,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2'843'534'243'843 == part2);
+    puzzle.Part(2, 2'843'534'243'843,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,15 +1,14 @@
 #include "day17.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/flathash.hpp"
 #include "../cpp-utils/point3d.hpp"
 #include "../cpp-utils/point4d.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
-#include <unordered_map>
-
 template <typename T>
-using Map = std::unordered_map<T, bool>;
+using Map = FlatHashMap<T, bool>;
 
 struct GOL3d
 {
@@ -19,7 +18,7 @@ struct GOL3d
     {
         Point3d pos{};
 
-        for (auto &&line : Split(mapText, "\n"))
+        for (auto &&line : Lines(mapText))
         {
             pos.x = 0;
 
@@ -138,7 +137,7 @@ struct GOL4d
     {
         Point4d pos{};
 
-        for (auto &&line : Split(mapText, "\n"))
+        for (auto &&line : Lines(mapText))
         {
             pos.x = 0;
 
@@ -282,18 +281,22 @@ static int Part2()
     return conwaysCube.BootSequence();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/17
-    std::println("Day 17, 2020: Conway Cubes");
+    puzzle.Title(2020, 17, "Conway Cubes");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(255 == part1);
+    puzzle.Part(1, 255,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2340 == part2);
+    puzzle.Part(2, 2340,
+        []
+        {
+            return Part2();
+        });
 }
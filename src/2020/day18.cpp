@@ -1,11 +1,11 @@
 #include "day18.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <charconv>
 #include <memory>
-#include <print>
 #include <string_view>
 
 using Int = int64_t;
@@ -348,7 +348,7 @@ static Int Eval2(std::string_view expression)
 static Int Part1()
 {
     Int result = 0;
-    for (auto &&expr : Split(GetInput(), '\n'))
+    for (auto &&expr : Lines(GetInput()))
     {
         result += Eval1(expr);
     }
@@ -360,7 +360,7 @@ static Int Part2()
 {
     Int result = 0;
 
-    for (auto &&expr : Split(GetInput(), '\n'))
+    for (auto &&expr : Lines(GetInput()))
     {
         result += Eval2(expr);
     }
@@ -368,10 +368,10 @@ static Int Part2()
     return result;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/18
-    std::println("Day 18, 2020: Operation Order");
+    puzzle.Title(2020, 18, "Operation Order");
 
     Assert(51 == Eval1("1 + (2 * 3) + (4 * (5 + 6))"));
     Assert(26 == Eval1("2 * 3 + (4 * 5)"));
@@ -385,11 +385,15 @@ int main()
     Assert(669'060 == Eval2("5 * 9 * (7 * 3 * 3 + 9 * 3 + (8 + 6 * 4))"));
     Assert(23'340 == Eval2("((2 + 4 * 9) * (6 + 9 * 8 + 6) + 6) + 2 + 4 * 2"));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(7'147'789'965'219 == part1);
+    puzzle.Part(1, 7'147'789'965'219,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(136'824'720'421'264 == part2);
+    puzzle.Part(2, 136'824'720'421'264,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,9 +1,9 @@
 #include "day19.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <unordered_map>
 
 enum struct Type
@@ -37,7 +37,7 @@ struct Rule
 
     void Parse(std::vector<RulePart> &parts, std::string_view text)
     {
-        for (auto part : Split(text, ' '))
+        for (auto part : Fields(text, ' '))
         {
             trim(part);
 
@@ -59,7 +59,7 @@ struct Rules
 
     void Parse(std::string_view rulesText)
     {
-        for (auto line : Split(rulesText, '\n'))
+        for (auto line : Lines(rulesText))
         {
             auto const parts = Split(line, ":");
             Add(trim_copy(parts[0]), trim_copy(parts[1]));
@@ -130,7 +130,7 @@ static int Part1(std::string_view rulesText, std::string_view values)
     rules.Parse(rulesText);
     int count = 0;
 
-    for (auto line : Split(values, '\n'))
+    for (auto line : Lines(values))
     {
         if (rules.IsValid(line))
         {
@@ -146,17 +146,23 @@ static int Part2()
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/19
-    std::println("Day 19, 2020: Monster Messages");
+    puzzle.Title(2020, 19, "Monster Messages");
 
     // Assert(2 == Part1(example::rules1, "aab\naba"));
 
-    auto const part1 = Part1(example::rules2, example::values2);
-    // auto const part1 = Part1(input::rules, input::values);
-    std::println("  Part 1: {}", part1);
+    puzzle.Part(1,
+        []
+        {
+            return Part1(example::rules2, example::values2);
+            // return Part1(input::rules, input::values);
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
@@ -53,18 +53,23 @@ static void Examples()
     Assert(1 == std::count_if(begin(example::passwords), end(example::passwords), &V2::IsPasswordValid));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/2
-    std::println("Day 2, 2020: Password Philosophy");
+    puzzle.Title(2020, 2, "Password Philosophy");
 
     Examples();
 
     auto const passwords = Split(GetInput(), '\n');
-    auto const part1 = std::count_if(begin(passwords), end(passwords), &V1::IsPasswordValid);
-    std::println("  Part 1: {}", part1);
-    Assert(666 == part1);
+    puzzle.Part(1, 666,
+        [&]
+        {
+            return std::count_if(begin(passwords), end(passwords), &V1::IsPasswordValid);
+        });
 
-    auto const part2 = std::count_if(begin(passwords), end(passwords), &V2::IsPasswordValid);
-    std::println("  Part 2: {}", part2);
+    puzzle.Part(2,
+        [&]
+        {
+            return std::count_if(begin(passwords), end(passwords), &V2::IsPasswordValid);
+        });
 }
@@ -1,11 +1,11 @@
 #include "day3.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <array>
 #include <numeric>
-#include <print>
 #include <span>
 
 struct Slope
@@ -57,21 +57,25 @@ struct Slope
     return CountTreesInSlopes(lines, slopes);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/3
-    std::println("Day 3, 2020: Toboggan Trajectory");
+    puzzle.Title(2020, 3, "Toboggan Trajectory");
 
-    constexpr std::array allSlopes{Slope{1, 1}, Slope{3, 1}, Slope{5, 1}, Slope{7, 1}, Slope{1, 2}};
+    static constexpr std::array allSlopes{Slope{1, 1}, Slope{3, 1}, Slope{5, 1}, Slope{7, 1}, Slope{1, 2}};
 
     Assert(7 == CountTrees(example::map, Slope{3, 1}));
     Assert(336 == CountTreesInSlopes(example::map, allSlopes));
 
-    auto const part1 = CountTrees(GetInput(), Slope{3, 1});
-    std::println("  Part 1: {}", part1);
-    Assert(232 == part1);
+    puzzle.Part(1, 232,
+        []
+        {
+            return CountTrees(GetInput(), Slope{3, 1});
+        });
 
-    auto const part2 = CountTreesInSlopes(GetInput(), allSlopes);
-    std::println("  Part 2: {}", part2);
-    Assert(3'952'291'680 == part2);
+    puzzle.Part(2, 3'952'291'680,
+        []
+        {
+            return CountTreesInSlopes(GetInput(), allSlopes);
+        });
 }
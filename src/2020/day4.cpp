@@ -1,8 +1,9 @@
 #include "day4.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/extract.hpp"
 
-#include <regex>
+#include <tuple>
 
 using namespace std::string_view_literals;
 
@@ -62,16 +63,23 @@ static bool IsPassportValid2(std::string_view passport)
         }
         else if (parts[0] == "hgt"sv) // Height
         {
-            int const value = svtoi(parts[1]);
+            auto const height = Extract<"{}{}", int, std::string_view>(parts[1]);
 
-            if (ends_with(parts[1], "cm"sv))
+            if (not height)
+            {
+                return false;
+            }
+
+            auto const [value, unit] = *height;
+
+            if (unit == "cm"sv)
             {
                 if (value < 150 || value > 193)
                 {
                     return false;
                 }
             }
-            else if (ends_with(parts[1], "in"sv))
+            else if (unit == "in"sv)
             {
                 if (value < 59 || value > 76)
                 {
@@ -85,8 +93,13 @@ static bool IsPassportValid2(std::string_view passport)
         }
         else if (parts[0] == "hcl"sv) // Hair Color
         {
-            std::regex re("#[a-f0-9]{6}");
-            if (not std::regex_match(begin(parts[1]), end(parts[1]), re))
+            auto const color = Extract<"#{}", std::string_view>(parts[1]);
+            auto const isHexDigit = [](char c)
+            {
+                return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+            };
+
+            if (not color || std::get<0>(*color).size() != 6 || not std::ranges::all_of(std::get<0>(*color), isHexDigit))
             {
                 return false;
             }
@@ -102,8 +115,12 @@ static bool IsPassportValid2(std::string_view passport)
         }
         else if (parts[0] == "pid"sv) // Passport ID
         {
-            std::regex re("\\d{9}");
-            if (not std::regex_match(begin(parts[1]), end(parts[1]), re))
+            auto const isDigit = [](char c)
+            {
+                return c >= '0' && c <= '9';
+            };
+
+            if (parts[1].size() != 9 || not std::ranges::all_of(parts[1], isDigit))
             {
                 return false;
             }
@@ -125,15 +142,20 @@ static int Part2()
     return static_cast<int>(std::count_if(begin(passports), end(passports), &IsPassportValid2));
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/4
-    std::println("Day 4, 2020: Passport Processing"sv);
+    puzzle.Title(2020, 4, "Passport Processing");
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(204 == part1);
+    puzzle.Part(1, 204,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,6 +1,7 @@
 #include "day5.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <algorithm>
@@ -121,21 +122,25 @@ static int Part2()
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/5
-    std::println("Day 5, 2020: Binary Boarding");
+    puzzle.Title(2020, 5, "Binary Boarding");
 
     Assert(357 == GetSeat("FBFBBFFRLR").GetId());
     Assert(567 == GetSeat("BFFFBBFRRR").GetId());
     Assert(119 == GetSeat("FFFBBBFRRR").GetId());
     Assert(820 == GetSeat("BBFFBBFRLL").GetId());
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(883 == part1);
+    puzzle.Part(1, 883,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(532 == part2);
+    puzzle.Part(2, 532,
+        []
+        {
+            return Part2();
+        });
 }
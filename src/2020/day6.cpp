@@ -1,11 +1,11 @@
 #include "day6.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
 #include <algorithm>
 #include <iterator>
-#include <print>
 #include <set>
 
 [[nodiscard]] static int GetCount1(std::string_view group)
@@ -29,7 +29,7 @@
 {
     int total = 0;
 
-    for (auto &&group : Split(answers, "\n\n"))
+    for (auto &&group : Blocks(answers))
     {
         total += GetCount1(group);
     }
@@ -42,7 +42,7 @@
     std::set<char> prev;
     bool first = true;
 
-    for (auto &&line : Split(group, "\n"))
+    for (auto &&line : Lines(group))
     {
         if (first)
         {
@@ -72,7 +72,7 @@
 [[nodiscard]] static int GetSum2(std::string_view answers)
 {
     int total = 0;
-    for (auto &&group : Split(answers, "\n\n"))
+    for (auto &&group : Blocks(answers))
     {
         total += GetCount2(group);
     }
@@ -80,19 +80,23 @@
     return total;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/6
-    std::println("Day 6, 2020: Custom Customs");
+    puzzle.Title(2020, 6, "Custom Customs");
 
     Assert(11 == GetSum1(example::answers));
     Assert(6 == GetSum2(example::answers));
 
-    auto const part1 = GetSum1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(6625 == part1);
+    puzzle.Part(1, 6625,
+        []
+        {
+            return GetSum1(GetInput());
+        });
 
-    auto const part2 = GetSum2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(3360 == part2);
+    puzzle.Part(2, 3360,
+        []
+        {
+            return GetSum2(GetInput());
+        });
 }
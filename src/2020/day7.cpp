@@ -1,25 +1,37 @@
 #include "day7.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/dag.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <map>
-#include <print>
-#include <set>
+#include <algorithm>
 #include <span>
-#include <string>
+#include <utility>
+#include <vector>
 
-struct Rule
+// the bags directly inside each bag, with their count, by the ids of the colors
+struct Rules
 {
-    std::string_view color;
-    std::map<std::string_view, int> contains;
+    Interner colors;
+    std::vector<std::vector<std::pair<std::uint32_t, int>>> contents;
+
+    // every bag after the bags it contains
+    Dag dag;
+
+    [[nodiscard]] std::uint32_t Id(std::string_view color) const
+    {
+        return colors.Find(color).value();
+    }
 };
 
-static Rule ParseRule(std::string_view ruleText)
+static void ParseRule(Rules &rules, std::string_view ruleText)
 {
     using namespace std::string_view_literals;
     auto parts = Split(ruleText, "bags contain"sv);
-    Rule rule{trim_copy(parts[0]), {}};
+    auto const color = rules.colors.Intern(trim_copy(parts[0]));
+    std::vector<std::pair<std::uint32_t, int>> contents;
     parts = Split(parts[1], ","sv);
 
     for (auto &&p : parts)
@@ -37,77 +49,72 @@ static Rule ParseRule(std::string_view ruleText)
         p.remove_prefix(static_cast<size_t>(result.ptr - p.data()));
         p.remove_suffix(p.size() - p.find("bag"sv));
         trim(p);
-        rule.contains.insert(std::make_pair(p, nbBags));
+        contents.emplace_back(rules.colors.Intern(p), nbBags);
+        rules.dag.AddInput(color, contents.back().first);
     }
 
-    return rule;
+    rules.contents.resize(rules.colors.Size());
+    rules.contents[color] = std::move(contents);
 }
 
-static std::vector<Rule> ParseRules(std::span<std::string_view const> rawRules)
+static Rules ParseRules(std::span<std::string_view const> rawRules)
 {
-    std::vector<Rule> rules;
+    Rules rules;
+
     for (auto &&rule : rawRules)
     {
-        rules.emplace_back(ParseRule(rule));
+        if (not rule.empty())
+        {
+            ParseRule(rules, rule);
+        }
     }
 
+    rules.contents.resize(rules.colors.Size());
+    rules.dag.Resize(rules.colors.Size());
     return rules;
 }
 
-static std::vector<std::string_view> GetParents(std::vector<Rule> const &rules, std::string_view bag)
+// bags that contain bag, directly or not
+static int GetAllParentsCount(Rules &rules, std::string_view bag)
 {
-    std::vector<std::string_view> parents;
-    for (auto &&r : rules)
-    {
-        if (auto iter = r.contains.find(bag); iter != end(r.contains))
+    auto const target = rules.Id(bag);
+    auto const contains = rules.dag.Evaluate<char>(
+        [&](std::uint32_t color, std::span<char const> values)
         {
-            parents.emplace_back(r.color);
-        }
-    }
+            return static_cast<char>(std::ranges::any_of(rules.contents[color],
+                [&](auto const &content)
+                {
+                    return content.first == target || values[content.first] != 0;
+                }));
+        });
 
-    return parents;
+    return static_cast<int>(std::ranges::count(contains, 1));
 }
 
-static void GetAllParents(std::vector<Rule> const &rules, std::string_view bag, std::set<std::string_view> &parents)
+// bags inside bag
+static int CountBags(Rules &rules, std::string_view bag)
 {
-    for (auto &&p : GetParents(rules, bag))
-    {
-        parents.insert(p);
-        GetAllParents(rules, p, parents);
-    }
-}
+    auto const counts = rules.dag.Evaluate<int>(
+        [&](std::uint32_t color, std::span<int const> values)
+        {
+            int total = 0;
 
-static int GetAllParentsCount(std::vector<Rule> const &rules, std::string_view bag)
-{
-    std::set<std::string_view> parents;
-    GetAllParents(rules, bag, parents);
-    return static_cast<int>(parents.size());
-}
+            for (auto const &[child, count] : rules.contents[color])
+            {
+                total += count + values[child] * count;
+            }
 
-static int CountBags(std::vector<Rule> const &rules, std::string_view bag)
-{
-    int total = 0;
-
-    auto iter = std::find_if(begin(rules), end(rules),
-        [&](Rule const &rule)
-        {
-            return rule.color == bag;
+            return total;
         });
 
-    for (auto &&child : iter->contains)
-    {
-        total += child.second;
-        total += CountBags(rules, child.first) * child.second;
-    }
-
-    return total;
+    return counts[rules.Id(bag)];
 }
 
 static void Example()
 {
 #ifndef NDEBUG
-    auto const rules1 = ParseRules(example::rules1);
-    auto const rules2 = ParseRules(example::rules2);
+    auto rules1 = ParseRules(example::rules1);
+    auto rules2 = ParseRules(example::rules2);
 
     Assert(4 == GetAllParentsCount(rules1, input::mybag));
     Assert(32 == CountBags(rules1, input::mybag));
@@ -117,28 +124,32 @@ static void Example()
 
 static int Part1()
 {
-    auto const rules = ParseRules(Split(GetInput(), '\n'));
+    auto rules = ParseRules(Split(GetInput(), '\n'));
     return GetAllParentsCount(rules, input::mybag);
 }
 
 static int Part2()
 {
-    auto const rules = ParseRules(Split(GetInput(), '\n'));
+    auto rules = ParseRules(Split(GetInput(), '\n'));
     return CountBags(rules, input::mybag);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/7
-    std::println("Day 7, 2020: Handy Haversacks");
+    puzzle.Title(2020, 7, "Handy Haversacks");
 
     Example();
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(224 == part1);
+    puzzle.Part(1, 224,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(1488 == part2);
+    puzzle.Part(2, 1488,
+        []
+        {
+            return Part2();
+        });
 }
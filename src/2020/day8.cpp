@@ -1,9 +1,9 @@
 #include "day8.hpp"
 
 #include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/puzzle.hpp"
 #include "../cpp-utils/string.hpp"
 
-#include <print>
 #include <set>
 #include <span>
 #include <utility>
@@ -150,19 +150,23 @@ static int Run2(std::string_view instructions)
     return Run2(lines);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/8
-    std::println("Day 8, 2020: Handheld Halting ");
+    puzzle.Title(2020, 8, "Handheld Halting ");
 
     Assert(5 == Run1(example::instructions));
     Assert(8 == Run2(example::instructions));
 
-    auto const part1 = Run1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(1528 == part1);
+    puzzle.Part(1, 1528,
+        []
+        {
+            return Run1(GetInput());
+        });
 
-    auto const part2 = Run2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(640 == part2);
+    puzzle.Part(2, 640,
+        []
+        {
+            return Run2(GetInput());
+        });
 }
@@ -65,16 +65,21 @@ static llong Part2(std::span<llong const> numbers, llong weak)
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2020/day/9
-    std::println("Day 9, 2020: Encoding Error");
+    puzzle.Title(2020, 9, "Encoding Error");
 
-    auto const part1 = FindOutlier(ParseInputNumbers<llong>(), input::preamble);
-    std::println("  Part 1: {}", part1);
-    Assert(14'360'655 == part1);
+    puzzle.Part(1, 14'360'655,
+        []
+        {
+            return FindOutlier(ParseInputNumbers<llong>(), input::preamble);
+        });
 
-    auto const part2 = Part2(ParseInputNumbers<llong>(), part1);
-    std::println("  Part 2: {}", part2);
-    Assert(1'962'331 == part2);
+    puzzle.Part(2, 1'962'331,
+        []
+        {
+            auto const numbers = ParseInputNumbers<llong>();
+            return Part2(numbers, FindOutlier(numbers, input::preamble));
+        });
 }
@@ -8,14 +8,7 @@
 
 static std::vector<int> ParseNumbers(std::string_view lines)
 {
-    std::vector<int> numbers;
-
-    for (auto line : Split(lines, '\n'))
-    {
-        numbers.push_back(svtoi(line));
-    }
-
-    return numbers;
+    return ParseIntegers(lines, '\n');
 }
 
 static int Part1(std::span<int const> values)
@@ -65,19 +58,23 @@ static int Part2(std::span<int const> values)
     return nbIncrease;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/1
-    std::println("Day 1, 2021: Sonar Sweep");
+    puzzle.Title(2021, 1, "Sonar Sweep");
 
     Assert(7 == Part1(example::numbers));
     Assert(5 == Part2(example::numbers));
 
-    auto const part1 = Part1(ParseNumbers(GetInput()));
-    std::println("  Part 1: {}", part1);
-    Assert(1316 == part1);
+    puzzle.Part(1, 1316,
+        []
+        {
+            return Part1(ParseNumbers(GetInput()));
+        });
 
-    auto const part2 = Part2(ParseNumbers(GetInput()));
-    std::println("  Part 2: {}", part2);
-    Assert(1344 == part2);
+    puzzle.Part(2, 1344,
+        []
+        {
+            return Part2(ParseNumbers(GetInput()));
+        });
 }
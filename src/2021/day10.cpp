@@ -110,7 +110,7 @@ static int Part1(std::string_view lines)
 {
     int score = 0;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         auto const c = GetCorruptedChar(line);
         if (c == '\0')
@@ -128,7 +128,7 @@ static int64_t Part2(std::string_view lines)
 {
     std::vector<int64_t> scores;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         std::vector<char> stack;
 
@@ -147,10 +147,10 @@ static int64_t Part2(std::string_view lines)
     return scores[middle];
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/10
-    std::println("Day 10, 2021: Syntax Scoring");
+    puzzle.Title(2021, 10, "Syntax Scoring");
 
     Assert(']' == GetCorruptedChar("(]"));
     Assert('>' == GetCorruptedChar("{()()()>"));
@@ -160,13 +160,15 @@ int main()
     Assert(294 == AutoCompleteScore("])}>"));
     Assert(288'957 == Part2(example::lines));
 
-    std::println("Debug: {}", AutoCompleteScore("])}>"));
-
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(288'291 == part1);
+    puzzle.Part(1, 288'291,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(820'045'242 == part2);
+    puzzle.Part(2, 820'045'242,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
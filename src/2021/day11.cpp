@@ -1,44 +1,32 @@
 #include "day11.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/grid2d.hpp"
 
 struct Environment
 {
-    std::unordered_map<Point2d, int8_t> map;
-    std::unordered_set<Point2d> flashed;
-    int width = 0;
-    int height = 0;
+    Grid2d<int8_t> map;
+    Grid2d<char> flashed;
+    int flashCount = 0;
 
     void Parse(std::string_view mapText)
     {
-        int y = 0;
-
-        for (auto line : Split(mapText, '\n'))
-        {
-            int x = 0;
-
-            for (char c : line)
+        map = ParseGrid(mapText,
+            [](char c)
             {
-                map[{x, y}] = static_cast<int8_t>(c - '0');
-                ++x;
-            }
-
-            width = x;
-            ++y;
-        }
-
-        height = y;
+                return static_cast<int8_t>(c - '0');
+            });
+        flashed = Grid2d<char>{map.Width(), map.Height()};
     }
 
     void Increase(Point2d const &p)
     {
-        auto iter = map.find(p);
-        if (iter == end(map))
+        if (not map.Contains(p))
         {
             return;
         }
 
-        auto &level = iter->second;
+        auto &level = map[p];
         ++level;
 
         if (level > 9)
@@ -49,12 +37,13 @@ struct Environment
 
     void Flash(Point2d const &p)
     {
-        if (flashed.find(p) != end(flashed))
+        if (flashed[p])
         {
             return;
         }
 
-        flashed.insert(p);
+        flashed[p] = 1;
+        ++flashCount;
         Increase(p + Point2d::NORTH);
         Increase(p + Point2d::NORTH_EAST);
         Increase(p + Point2d::EAST);
@@ -67,30 +56,31 @@ struct Environment
 
     int Step()
     {
-        flashed.clear();
+        flashed.Fill(0);
+        flashCount = 0;
 
-        for (auto &[p, l] : map)
+        for (auto p : map.Points())
         {
-            if (++l > 9)
+            if (++map[p] > 9)
             {
                 Flash(p);
             }
         }
 
-        for (auto &[p, l] : map)
+        for (auto p : map.Points())
         {
-            if (l > 9)
+            if (map[p] > 9)
             {
-                l = 0;
+                map[p] = 0;
             }
         }
 
-        return static_cast<int>(flashed.size());
+        return flashCount;
     }
 
     bool AllFlashed() const
     {
-        return flashed.size() == map.size();
+        return flashCount == map.Width() * map.Height();
     }
 };
 
@@ -123,20 +113,24 @@ static int Part2(std::string_view lines)
     return step;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/11
-    std::println("Day 11, 2021: Dumbo Octopus");
+    puzzle.Title(2021, 11, "Dumbo Octopus");
 
     Assert(204 == Part1(example::energyLevels, 10));
     Assert(1656 == Part1(example::energyLevels, 100));
     Assert(195 == Part2(example::energyLevels));
 
-    auto const part1 = Part1(GetInput(), 100);
-    std::println("  Part 1: {}", part1);
-    Assert(1793 == part1);
+    puzzle.Part(1, 1793,
+        []
+        {
+            return Part1(GetInput(), 100);
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(247 == part2);
+    puzzle.Part(2, 247,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
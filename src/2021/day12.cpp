@@ -1,128 +1,89 @@
 #include "day12.hpp"
 
 #include "../cpp-utils.hpp"
-
-using namespace std::string_view_literals;
-
-struct Cave
-{
-    static Cave const Start;
-    static Cave const End;
-    inline static std::hash<std::string_view> const hasher;
-
-    size_t id;
-    bool lower;
-    std::string_view cave_;
-
-    Cave(std::string_view cave)
-        : id{hasher(cave)}
-        , lower{std::all_of(begin(cave), end(cave), &islower)}
-        , cave_(std::move(cave))
-    {
-    }
-
-    bool IsStart() const
-    {
-        return id == Start.id;
-    }
-
-    bool IsEnd() const
-    {
-        return id == End.id;
-    }
-
-    bool operator==(Cave const &c) const
-    {
-        return id == c.id;
-    }
-
-    bool operator<(Cave const &c) const
-    {
-        return id < c.id;
-    }
-};
-
-Cave const Cave::Start{"start"sv};
-Cave const Cave::End{"end"sv};
-
-template <>
-struct std::hash<Cave>
-{
-    std::size_t operator()(Cave const &c) const noexcept
-    {
-        return c.id;
-    }
-};
+#include "../cpp-utils/interner.hpp"
 
 struct Paths
 {
-    std::unordered_map<Cave, std::vector<Cave>> paths;
+    static constexpr std::uint32_t kStart = 0;
+    static constexpr std::uint32_t kEnd = 1;
+
+    // by the ids of the names of the caves
+    Interner caves;
+    std::vector<std::vector<std::uint32_t>> paths;
+    std::vector<char> small;
+    std::vector<int> visits;
 
     void Parse(std::string_view map)
     {
-        for (auto line : Split(map, '\n'))
+        caves.Intern("start");
+        caves.Intern("end");
+
+        for (auto line : Lines(map))
         {
+            if (line.empty())
+            {
+                continue;
+            }
+
             auto parts = Split(line, '-');
-            Cave const left = parts[0];
-            Cave const right = parts[1];
+            auto const left = caves.Intern(parts[0]);
+            auto const right = caves.Intern(parts[1]);
+            paths.resize(caves.Size());
 
-            if (not right.IsStart() && not left.IsEnd())
+            if (right != kStart && left != kEnd)
             {
                 paths[left].push_back(right);
             }
 
-            if (not left.IsStart() && not right.IsEnd())
+            if (left != kStart && right != kEnd)
             {
                 paths[right].push_back(left);
             }
         }
+
+        for (auto name : caves.Names())
+        {
+            small.push_back(std::ranges::all_of(name, &islower) ? 1 : 0);
+        }
     }
 
     auto FindAllPaths(int maxCount)
     {
         int allPaths = 0;
-        FindAllPaths(Cave::Start, {}, allPaths, maxCount);
+        visits.assign(caves.Size(), 0);
+        FindAllPaths(kStart, allPaths, maxCount);
         return allPaths;
     }
 
 private:
-    void FindAllPaths(Cave const &start, std::vector<Cave> parents, int &nbPaths, int maxCount)
+    void FindAllPaths(std::uint32_t cave, int &nbPaths, int maxCount)
     {
-        if (start.IsEnd())
+        if (cave == kEnd)
         {
             ++nbPaths;
             return;
         }
 
-        auto iter = paths.find(start);
-
-        if (iter == end(paths))
+        // only visit small caves once
+        if (small[cave] && visits[cave] > 0)
         {
-            return;
-        }
-
-        // only visit samll caves once
-        if (start.lower)
-        {
-            auto const visitedCount = std::count(begin(parents), end(parents), start);
-
-            if (maxCount == 1 && visitedCount >= 1)
+            if (maxCount == 1)
             {
                 return;
             }
 
-            if (visitedCount > 0)
-            {
-                --maxCount;
-            }
+            --maxCount;
         }
 
-        parents.push_back(start);
+        ++visits[cave];
 
-        for (auto p : iter->second)
+        for (auto next : paths[cave])
         {
-            FindAllPaths(p, parents, nbPaths, maxCount);
+            FindAllPaths(next, nbPaths, maxCount);
         }
+
+        --visits[cave];
     }
 };
 
@@ -140,10 +101,10 @@ static int Part2(std::string_view map)
     return p.FindAllPaths(2);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/12
-    std::println("Day 12, 2021: Passage Pathing");
+    puzzle.Title(2021, 12, "Passage Pathing");
 
     Assert(10 == Part1(example::map1));
     Assert(19 == Part1(example::map2));
@@ -152,11 +113,15 @@ int main()
     Assert(103 == Part2(example::map2));
     Assert(3509 == Part2(example::map3));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(3298 == part1);
+    puzzle.Part(1, 3298,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(93'572 == part2);
+    puzzle.Part(2, 93'572,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -1,15 +1,16 @@
 #include "day13.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/flathash.hpp"
 
 struct Map
 {
-    std::unordered_set<Point2d> map;
+    FlatHashSet<Point2d> map;
     std::vector<Point2d> folds;
 
     void Parse(std::string_view text)
     {
-        for (auto line : Split(text, '\n'))
+        for (auto line : Lines(text))
         {
             if (starts_with(line, "fold along x="))
             {
@@ -33,7 +34,7 @@ struct Map
 
     void FoldX(int x)
     {
-        std::unordered_set<Point2d> folded;
+        FlatHashSet<Point2d> folded;
 
         for (Point2d p : map)
         {
@@ -52,7 +53,7 @@ struct Map
 
     void FoldY(int y)
     {
-        std::unordered_set<Point2d> folded;
+        FlatHashSet<Point2d> folded;
 
         for (Point2d p : map)
         {
@@ -165,17 +166,22 @@ static auto Part2(std::string_view text)
     return map.Print();
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/13
-    std::println("Day 13, 2021: Transparent Origami");
+    puzzle.Title(2021, 13, "Transparent Origami");
 
     Assert(17 == Part1(example::instructions));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(592 == part1);
+    puzzle.Part(1, 592,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2:\n{}", part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -24,7 +24,7 @@ struct PolymerTemplate
 
     void Parse(std::string_view text)
     {
-        for (auto line : Split(text, '\n'))
+        for (auto line : Lines(text))
         {
             if (line.empty())
             {
@@ -109,19 +109,23 @@ static auto Part2(std::string_view text)
     return t.Step(40);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/14
-    std::println("Day 14, 2021: Extended Polymerization");
+    puzzle.Title(2021, 14, "Extended Polymerization");
 
     Assert(1588 == Part1(example::polymer));
     Assert(2'188'189'693'529 == Part2(example::polymer));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(3587 == part1);
+    puzzle.Part(1, 3587,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(3'906'445'077'999 == part2);
+    puzzle.Part(2, 3'906'445'077'999,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
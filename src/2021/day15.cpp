@@ -1,38 +1,21 @@
 #include "day15.hpp"
 
 #include "../cpp-utils.hpp"
-
-struct State
-{
-    int risk;
-    Point2d current;
-};
+#include "../cpp-utils/bucketqueue.hpp"
+#include "../cpp-utils/dijkstra.hpp"
+#include "../cpp-utils/gridview.hpp"
 
 struct Map
 {
-    std::unordered_map<Point2d, int> map;
+    GridView map;
     int width = 0;
     int height = 0;
 
     void Parse(std::string_view text)
     {
-        int y = 0;
-
-        for (auto line : Split(text, '\n'))
-        {
-            int x = 0;
-
-            for (char c : line)
-            {
-                map[{x, y}] = c - '0';
-                ++x;
-            }
-
-            width = x;
-            ++y;
-        }
-
-        height = y;
+        map = GridView{text};
+        width = map.Width();
+        height = map.Height();
     }
 
     int Risk(Point2d p) const
@@ -40,14 +23,7 @@ struct Map
         int const offset = p.x / width + p.y / height;
         p.x %= width;
         p.y %= height;
-        auto iterTo = map.find(p);
-
-        if (iterTo == end(map))
-        {
-            throw std::invalid_argument("p");
-        }
-
-        return LimitScore(iterTo->second + offset);
+        return LimitScore(map[p] - '0' + offset);
     }
 
     static int LimitScore(int score)
@@ -60,11 +36,6 @@ struct Map
         return std::array{current + Point2d::WEST, current + Point2d::NORTH, current + Point2d::EAST, current + Point2d::SOUTH};
     }
 
-    static size_t GetOffset(Point2d p, int w)
-    {
-        return static_cast<size_t>(p.y * w + p.x);
-    }
-
     static bool Inbound(Point2d const &p, Point2d const &goal)
     {
         return p.x >= 0 && p.y >= 0 && p.x <= goal.x && p.y <= goal.y;
@@ -72,57 +43,28 @@ struct Map
 
     int Solve(int factor) const
     {
-        // based on: https://github.com/willkill07/AdventOfCode2021/blob/main/days/Day15.cpp
-        int const w = width * factor;
-        int const h = height * factor;
-        Point2d const goal{w - 1, h - 1};
-        std::vector<std::uint8_t> seen(static_cast<size_t>(w * h));
-        std::vector<std::vector<State>> queues(10);
-
-        for (auto &q : queues)
-        {
-            q.reserve(static_cast<size_t>((w + h) * 2));
-        }
-
-        queues.front().push_back({0, Point2d{}});
+        // the risks are 1 to 9, a ring of buckets is the cheapest queue, and the nodes of
+        // the whole map fit in a grid
+        Point2d const goal{width * factor - 1, height * factor - 1};
+        Dijkstra<Point2d, int, BucketQueue, PointNodes<int>> search{PointNodes<int>{Point2d{}, goal}};
 
-        while (true)
-        {
-            for (auto &q : queues)
+        auto const risk = search.Solve(Point2d{},
+            [&](Point2d current, auto &&visit)
             {
-                while (not q.empty())
+                for (auto n : Neighbors(current))
                 {
-                    auto const [risk, current] = q.back();
-                    q.pop_back();
-
-                    if (current == goal)
+                    if (Inbound(n, goal))
                     {
-                        return risk;
-                    }
-
-                    if (seen[GetOffset(current, w)])
-                    {
-                        continue;
-                    }
-
-                    seen[GetOffset(current, w)] = 1U;
-
-                    for (auto n : Neighbors(current))
-                    {
-                        if (not Inbound(n, goal))
-                        {
-                            continue;
-                        }
-
-                        if (not seen[GetOffset(n, w)])
-                        {
-                            auto const newRisk = risk + Risk(n);
-                            queues[static_cast<size_t>(newRisk % 10)].push_back({newRisk, n});
-                        }
+                        visit(n, Risk(n));
                     }
                 }
-            }
-        }
+            },
+            [&](Point2d p)
+            {
+                return p == goal;
+            });
+
+        return risk.value();
     }
 };
 
@@ -140,19 +82,23 @@ static int Part2(std::string_view text)
     return m.Solve(5);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/15
-    std::println("Day 15, 2021: Chiton");
+    puzzle.Title(2021, 15, "Chiton");
 
     Assert(40 == Part1(example::map));
     Assert(315 == Part2(example::map));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(447 == part1);
+    puzzle.Part(1, 447,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(2825 == part2);
+    puzzle.Part(2, 2825,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
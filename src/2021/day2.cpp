@@ -7,7 +7,7 @@ static int Part1(std::string_view text)
     int pos = 0;
     int depth = 0;
 
-    for (auto const &line : Split(text, '\n'))
+    for (auto const &line : Lines(text))
     {
         if (starts_with(line, "forward "))
         {
@@ -32,7 +32,7 @@ static int Part2(std::string_view text)
     int depth = 0;
     int aim = 0;
 
-    for (auto const &line : Split(text, '\n'))
+    for (auto const &line : Lines(text))
     {
         if (starts_with(line, "forward "))
         {
@@ -55,19 +55,23 @@ static int Part2(std::string_view text)
     return pos * depth;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/2
-    std::println("Day 2, 2021: Dive!");
+    puzzle.Title(2021, 2, "Dive!");
 
     Assert(150 == Part1(example::directions));
     Assert(900 == Part2(example::directions));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(1'694'130 == part1);
+    puzzle.Part(1, 1'694'130,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(1'698'850'445 == part2);
+    puzzle.Part(2, 1'698'850'445,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -10,7 +10,7 @@ std::vector<unsigned int> ParseBits(std::string_view lines)
 {
     std::vector<unsigned int> numbers;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         numbers.push_back(svtoi<unsigned int>(line, 2));
     }
@@ -126,19 +126,23 @@ static unsigned int Part2(std::vector<unsigned int> numbers)
     return co2 * oxygen;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/3
-    std::println("Day 3, 2021: Binary Diagnostic");
+    puzzle.Title(2021, 3, "Binary Diagnostic");
 
     Assert(198 == Part1(example::numbers));
     Assert(230 == Part2(example::numbers));
 
-    auto const part1 = Part1(ParseBits(GetInput()));
-    std::println("  Part 1: {}", part1);
-    Assert(841'526 == part1);
+    puzzle.Part(1, 841'526,
+        []
+        {
+            return Part1(ParseBits(GetInput()));
+        });
 
-    auto const part2 = Part2(ParseBits(GetInput()));
-    std::println("  Part 2: {}", part2);
-    Assert(4'790'390 == part2);
+    puzzle.Part(2, 4'790'390,
+        []
+        {
+            return Part2(ParseBits(GetInput()));
+        });
 }
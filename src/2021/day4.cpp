@@ -16,11 +16,11 @@ struct Board
     {
         auto row = begin(board);
 
-        for (auto line : Split(boardText, '\n'))
+        for (auto line : Lines(boardText))
         {
             auto col = begin(*row);
 
-            for (auto number : Split(line, ' '))
+            for (auto number : Fields(line, ' '))
             {
                 if (number.empty())
                 {
@@ -107,10 +107,7 @@ struct Input
 
     void ParseDraw(std::string_view numbers)
     {
-        for (auto number : Split(numbers, ','))
-        {
-            draw.push_back(svtoi(number));
-        }
+        draw = ParseIntegers(numbers, ',');
     }
 };
 
@@ -118,7 +115,7 @@ static std::vector<Board> ParseBoards(std::string_view boardsText)
 {
     std::vector<Board> boards;
 
-    for (auto boardText : Split(boardsText, "\n\n"))
+    for (auto boardText : Blocks(boardsText))
     {
         boards.emplace_back().Parse(boardText);
     }
@@ -180,19 +177,23 @@ static int Part2(Input const &input)
     return Part2(input.draw, input.boards);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/4
-    std::println("Day 4, 2021: Giant Squid");
+    puzzle.Title(2021, 4, "Giant Squid");
 
     Assert(4512 == Part1(example::draw, example::boards));
     Assert(1924 == Part2(example::draw, example::boards));
 
-    auto const part1 = Part1(Input{});
-    std::println("  Part 1: {}", part1);
-    Assert(29'440 == part1);
+    puzzle.Part(1, 29'440,
+        []
+        {
+            return Part1(Input{});
+        });
 
-    auto const part2 = Part2(Input{});
-    std::println("  Part 2: {}", part2);
-    Assert(13'884 == part2);
+    puzzle.Part(2, 13'884,
+        []
+        {
+            return Part2(Input{});
+        });
 }
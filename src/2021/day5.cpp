@@ -95,7 +95,7 @@ static int Part1(std::string_view lines)
 {
     std::map<Point2d, int> map;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         Line const ventLine = Line::Parse(line);
 
@@ -116,7 +116,7 @@ static int Part2(std::string_view lines)
 {
     std::map<Point2d, int> map;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         Line const ventLine = Line::Parse(line);
 
@@ -137,21 +137,25 @@ static int Part2(std::string_view lines)
     return GetOverlap(map);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/5
-    std::println("Day 5, 2021: Hydrothermal Venture");
+    puzzle.Title(2021, 5, "Hydrothermal Venture");
 
     Assert(5 == Part1(example::lines));
     Assert((Line{{1, 1}, {3, 3}}.IsDiagonal()));
     Assert((Line{{9, 7}, {7, 9}}.IsDiagonal()));
     Assert(12 == Part2(example::lines));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(5835 == part1);
+    puzzle.Part(1, 5835,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(17'013 == part2);
+    puzzle.Part(2, 17'013,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -4,14 +4,7 @@
 
 static std::vector<int8_t> ParseInput()
 {
-    std::vector<int8_t> numbers;
-
-    for (auto number : Split(GetInput(), ','))
-    {
-        numbers.push_back(svtoi<int8_t>(number));
-    }
-
-    return numbers;
+    return ParseInputNumbers<int8_t, ','>();
 }
 static uint64_t Run(std::span<int8_t const> fishes, int const days)
 {
@@ -41,20 +34,24 @@ static uint64_t Part2(std::span<int8_t const> fishes)
     return Run(fishes, 256);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/6
-    std::println("Day 6, 2021: Lanternfish");
+    puzzle.Title(2021, 6, "Lanternfish");
 
     Assert(26 == Run(example::fishes, 18));
     Assert(5934 == Run(example::fishes, 80));
     Assert(26'984'457'539 == Run(example::fishes, 256));
 
-    auto const part1 = Part1(ParseInput());
-    std::println("  Part 1: {}", part1);
-    Assert(359'344 == part1);
-
-    auto const part2 = Part2(ParseInput());
-    std::println("  Part 2: {}", part2);
-    Assert(1'629'570'219'571 == part2);
+    puzzle.Part(1, 359'344,
+        []
+        {
+            return Part1(ParseInput());
+        });
+
+    puzzle.Part(2, 1'629'570'219'571,
+        []
+        {
+            return Part2(ParseInput());
+        });
 }
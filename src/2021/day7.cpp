@@ -5,14 +5,7 @@
 
 static std::vector<int> ParseInput()
 {
-    std::vector<int> numbers;
-
-    for (auto number : Split(GetInput(), ','))
-    {
-        numbers.push_back(svtoi(number));
-    }
-
-    return numbers;
+    return ParseInputNumbers<int, ','>();
 }
 
 static int GetFuelCostSimple(std::span<int const> numbers, int position)
@@ -62,21 +55,25 @@ static int Part2(std::span<int const> numbers)
     return Compute(numbers, &GetFuelCostTriangular);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/7
-    std::println("Day 7, 2021: The Treachery of Whales");
+    puzzle.Title(2021, 7, "The Treachery of Whales");
 
     Assert(37 == Part1(example::positions));
     Assert(37 == GetFuelCostSimple(example::positions, 2));
     Assert(206 == GetFuelCostTriangular(example::positions, 2));
     Assert(168 == Part2(example::positions));
 
-    auto const part1 = Part1(ParseInput());
-    std::println("  Part 1: {}", part1);
-    Assert(323'647 == part1);
+    puzzle.Part(1, 323'647,
+        []
+        {
+            return Part1(ParseInput());
+        });
 
-    auto const part2 = Part2(ParseInput());
-    std::println("  Part 2: {}", part2);
-    Assert(87'640'209 == part2);
+    puzzle.Part(2, 87'640'209,
+        []
+        {
+            return Part2(ParseInput());
+        });
 }
@@ -10,7 +10,7 @@ static int CountSimple(std::string_view signalPatterns)
 {
     int count = 0;
 
-    for (auto pattern : Split(signalPatterns, ' '))
+    for (auto pattern : Fields(signalPatterns, ' '))
     {
         auto const size = pattern.size();
 
@@ -27,7 +27,7 @@ static int Part1(std::string_view entries)
 {
     int count = 0;
 
-    for (auto line : Split(entries, '\n'))
+    for (auto line : Lines(entries))
     {
         auto const parts = Split(line, '|');
         count += CountSimple(trim_copy(parts[1]));
@@ -156,7 +156,7 @@ static int MapNumber(auto const &mapping, std::string_view text)
     int result = 0;
     int mult = 1000;
 
-    for (auto const &n : Split(text, ' '))
+    for (auto const &n : Fields(text, ' '))
     {
         auto const s = ToSegments(n);
         auto const digit = static_cast<int>(std::find(begin(mapping), end(mapping), s) - begin(mapping));
@@ -171,7 +171,7 @@ static int Part2(std::string_view entries)
 {
     int total = 0;
 
-    for (auto line : Split(entries, '\n'))
+    for (auto line : Lines(entries))
     {
         auto const parts = Split(line, '|');
         auto const mapping = Analyze(trim_copy(parts[0]));
@@ -181,19 +181,23 @@ static int Part2(std::string_view entries)
     return total;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/8
-    std::println("Day 8, 2021: Seven Segment Search");
+    puzzle.Title(2021, 8, "Seven Segment Search");
 
     Assert(26 == Part1(example::entries));
     Assert(61'229 == Part2(example::entries));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(392 == part1);
+    puzzle.Part(1, 392,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(1'004'688 == part2);
+    puzzle.Part(2, 1'004'688,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -1,46 +1,32 @@
 #include "day9.hpp"
 
 #include "../cpp-utils.hpp"
-
-#include <unordered_map>
-#include <unordered_set>
+#include "../cpp-utils/grid2d.hpp"
+#include "../cpp-utils/unionfind.hpp"
 
 struct Map
 {
-    std::unordered_map<Point2d, int> map;
-    using Bassin = std::unordered_set<Point2d>;
-    std::vector<Bassin> bassins;
+    // surrounded by a border of 9, which no bassin crosses
+    Grid2d<int> map;
+    std::vector<int> bassins;
     int width = 0;
     int height = 0;
 
     void ParseMap(std::string_view mapText)
     {
-        int y = 0;
-        for (auto row : Split(mapText, '\n'))
-        {
-            int x = 0;
-
-            for (char c : row)
+        map = ParseGrid(mapText,
+            [](char c)
             {
-                map[{x, y}] = c - '0';
-                ++x;
-            }
-
-            width = std::max(x, width);
-            ++y;
-        }
-
-        height = y;
+                return c - '0';
+            },
+            9, 1);
+        width = map.Width();
+        height = map.Height();
     }
 
     int GetValue(Point2d const &p) const
     {
-        if (auto iter = map.find(p); iter != end(map))
-        {
-            return iter->second;
-        }
-
-        return 9;
+        return map[p];
     }
 
     std::vector<Point2d> GetLowSpots() const
@@ -83,47 +69,25 @@ struct Map
             });
     }
 
-    void FillBassin(Bassin &bassin, Point2d pos) const
-    {
-        if (GetValue(pos) == 9)
-        {
-            return;
-        }
-
-        if (auto const [iter, inserted] = bassin.insert(pos); not inserted)
-        {
-            return;
-        }
-
-        FillBassin(bassin, pos + Point2d::NORTH);
-        FillBassin(bassin, pos + Point2d::WEST);
-        FillBassin(bassin, pos + Point2d::EAST);
-        FillBassin(bassin, pos + Point2d::SOUTH);
-    }
-
     void FindAllBassins()
     {
+        // the cells of a bassin are connected, and each bassin has one low spot
+        GridDisjointSets sets{map.Min(), map.Max()};
+        sets.ConnectAll(
+            [this](Point2d a, Point2d b)
+            {
+                return map[a] != 9 && map[b] != 9;
+            });
+
         for (auto p : GetLowSpots())
         {
-            auto &bassin = bassins.emplace_back();
-            FillBassin(bassin, p);
+            bassins.push_back(sets.Size(p));
         }
     }
 
-    static int BassinSize(Bassin const &b)
-    {
-        return static_cast<int>(b.size());
-    }
-
     int GetSizeOfLargestBassins(int nb) const
     {
-        std::vector<int> sizes(bassins.size());
-        std::transform(begin(bassins), end(bassins), begin(sizes),
-            [](Bassin const &b)
-            {
-                return static_cast<int>(b.size());
-            });
-
+        std::vector<int> sizes = bassins;
         auto first = begin(sizes);
         auto topn = first + nb;
         std::nth_element(first, topn, end(sizes), std::greater{});
@@ -146,19 +110,23 @@ static int Part2(std::string_view mapText)
     return m.GetSizeOfLargestBassins(3);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2021/day/9
-    std::println("Day 9, 2021: Smoke Basin");
+    puzzle.Title(2021, 9, "Smoke Basin");
 
     Assert(15 == Part1(example::map));
     Assert(1134 == Part2(example::map));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(562 == part1);
+    puzzle.Part(1, 562,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(1'076'922 == part2);
+    puzzle.Part(2, 1'076'922,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
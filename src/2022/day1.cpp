@@ -9,7 +9,7 @@ static auto Part1(std::string_view lines)
     int64_t calories = 0;
     int64_t biggest = 0;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         if (line.empty())
         {
@@ -27,7 +27,7 @@ static auto Part2(std::string_view lines)
     std::vector<int64_t> elves;
     int64_t calories = 0;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         if (line.empty())
         {
@@ -42,19 +42,23 @@ static auto Part2(std::string_view lines)
     return std::accumulate(begin(elves), begin(elves) + 3, int64_t{0});
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/1
-    std::println("Day 1, 2022: Calorie Counting");
+    puzzle.Title(2022, 1, "Calorie Counting");
 
     Assert(24'000 == Part1(example::lines));
     Assert(45'000 == Part2(example::lines));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(65'912 == part1);
+    puzzle.Part(1, 65'912,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(195'625 == part2);
+    puzzle.Part(2, 195'625,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
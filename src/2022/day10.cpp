@@ -98,7 +98,7 @@ struct CPU
 
     CPU &Run(std::string_view instructions)
     {
-        for (auto instr : Split(instructions, '\n'))
+        for (auto instr : Lines(instructions))
         {
             Step(instr);
         }
@@ -146,20 +146,24 @@ static auto Part2()
     return PrintProgram(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/10
-    std::println("Day 10, 2022: Cathode-Ray Tube");
+    puzzle.Title(2022, 10, "Cathode-Ray Tube");
 
     Assert(-1 == CPU{}.Run(example::small_program).GetX());
     Assert(13'140 == RunProgram(example::large_program));
     Assert(example::expected == PrintProgram(example::large_program));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(11'220 == part1);
+    puzzle.Part(1, 11'220,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2:\n{}", part2);
-    Assert(input::expected == part2);
+    puzzle.Part(2, input::expected,
+        []
+        {
+            return Part2();
+        });
 }
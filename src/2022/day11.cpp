@@ -10,7 +10,7 @@ static std::vector<Item> ParseItems(std::string_view line)
 {
     std::vector<Item> items;
 
-    for (auto startItem : Split(Split(line, ':')[1], ','))
+    for (auto startItem : Fields(Split(line, ':')[1], ','))
     {
         trim(startItem);
         items.push_back(svtoi<Item>(startItem));
@@ -107,7 +107,7 @@ struct Game
 
     void ParseNotes(std::string_view notes)
     {
-        for (auto block : Split(notes, "\n\n"))
+        for (auto block : Blocks(notes))
         {
             monkeys.push_back(Monkey::Parse(block));
         }
@@ -204,10 +204,10 @@ static auto Part2()
     return PlayGameModulo(GetInput(), 10'000);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/11
-    std::println("Day 11, 2022: Monkey in the Middle");
+    puzzle.Title(2022, 11, "Monkey in the Middle");
 
     Assert(10'605 == PlayGameDivideBy3(example::notes, 20));
     Assert(6 * 4 == PlayGameModulo(example::notes, 1));
@@ -215,11 +215,15 @@ int main()
     Assert(5204 * 5192 == PlayGameModulo(example::notes, 1000));
     Assert(2'713'310'158 == PlayGameModulo(example::notes, 10'000));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(50'830 == part1);
+    puzzle.Part(1, 50'830,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(14'399'640'002 == part2);
+    puzzle.Part(2, 14'399'640'002,
+        []
+        {
+            return Part2();
+        });
 }
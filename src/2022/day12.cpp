@@ -1,87 +1,72 @@
 #include "day12.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/arena.hpp"
+#include "../cpp-utils/bucketqueue.hpp"
 #include "../cpp-utils/dijkstra.hpp"
+#include "../cpp-utils/gridview.hpp"
 
 struct Map
 {
-    std::unordered_map<Point2d, int> map;
+    GridView map;
     Point2d start;
     Point2d target;
 
     void Parse(std::string_view mapText)
     {
-        int y = 0;
-
-        for (auto line : Split(mapText, '\n'))
-        {
-            int x = 0;
-
-            for (char c : line)
-            {
-                Point2d p{x++, y};
-
-                if (c == 'S')
-                {
-                    start = p;
-                    c = 'a';
-                }
-                else if (c == 'E')
-                {
-                    target = p;
-                    c = 'z';
-                }
-
-                map[p] = c - 'a';
-            }
-
-            ++y;
-        }
+        map = GridView{mapText};
+        start = map.Find('S').value();
+        target = map.Find('E').value();
     }
 
-    static constexpr int kInvalidHeight = -1;
-
     int GetHeight(Point2d p) const
     {
-        if (auto it = map.find(p); it != end(map))
+        switch (char const c = map[p])
         {
-            return it->second;
+            case 'S':
+                return 0;
+            case 'E':
+                return 'z' - 'a';
+            default:
+                return c - 'a';
         }
-
-        return kInvalidHeight;
     }
 };
 
+// enough for the whole search on the puzzle input
+static constexpr std::size_t arenaSize = std::size_t{1} << 20;
+
 static auto Solve(std::string_view mapText)
 {
     Map map;
     map.Parse(mapText);
 
-    Dijkstra solver{map.map,
-        [](Point2d from, Point2d to)
-        {
-            return from.Distance(to);
-        },
-        [&](Point2d from, Point2d to)
-        {
-            auto const fromHeight = map.GetHeight(from);
-            auto const toHeight = map.GetHeight(to);
+    Arena arena{arenaSize};
+    Dijkstra<Point2d, int, BucketQueue> search{arena.Resource()};
 
-            if (fromHeight == Map::kInvalidHeight || toHeight == Map::kInvalidHeight)
+    // one step per move: the manhattan distance never overestimates what is left, and the
+    // priorities never decrease, as the bucket queue requires
+    auto const steps = search.Solve(map.start,
+        [&](Point2d from, auto &&visit)
+        {
+            for (auto to : map.map.Neighbors(from))
             {
-                return false;
+                if (map.GetHeight(to) - map.GetHeight(from) <= 1)
+                {
+                    visit(to, 1);
+                }
             }
-
-            int const distance = toHeight - fromHeight;
-            return distance <= 1;
         },
         [&](Point2d to)
         {
             return to == map.target;
-        }};
+        },
+        [&](Point2d p)
+        {
+            return p.Distance(map.target);
+        });
 
-    auto const path = solver.Solve(map.start);
-    return path.size();
+    return steps.value();
 }
 
 static auto SolveReverse(std::string_view mapText)
@@ -89,31 +74,26 @@ static auto SolveReverse(std::string_view mapText)
     Map map;
     map.Parse(mapText);
 
-    Dijkstra solver{map.map,
-        [](Point2d from, Point2d to)
-        {
-            return from.Distance(to);
-        },
-        [&](Point2d from, Point2d to)
-        {
-            auto const fromHeight = map.GetHeight(from);
-            auto const toHeight = map.GetHeight(to);
+    Arena arena{arenaSize};
+    Dijkstra<Point2d, int, BucketQueue> search{arena.Resource()};
 
-            if (fromHeight == Map::kInvalidHeight || toHeight == Map::kInvalidHeight)
+    auto const steps = search.Solve(map.target,
+        [&](Point2d from, auto &&visit)
+        {
+            for (auto to : map.map.Neighbors(from))
             {
-                return false;
+                if (map.GetHeight(from) - map.GetHeight(to) <= 1)
+                {
+                    visit(to, 1);
+                }
             }
-
-            int const distance = fromHeight - toHeight;
-            return distance <= 1;
         },
         [&](Point2d to)
         {
             return map.GetHeight(to) == 0;
-        }};
+        });
 
-    auto const path = solver.Solve(map.target);
-    return path.size();
+    return steps.value();
 }
 
 static auto Part1()
@@ -126,19 +106,23 @@ static auto Part2()
     return SolveReverse(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/12
-    std::println("Day 12, 2022: Hill Climbing Algorithm");
+    puzzle.Title(2022, 12, "Hill Climbing Algorithm");
 
     Assert(31 == Solve(example::map));
     Assert(29 == SolveReverse(example::map));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(412 == part1);
+    puzzle.Part(1, 412,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(402 == part2);
+    puzzle.Part(2, 402,
+        []
+        {
+            return Part2();
+        });
 }
@@ -148,7 +148,7 @@ static int SumOrderedPairs(std::string_view input)
 {
     int sum = 0;
     int pairIndex = 0;
-    for (auto chunk : Split(input, "\n\n"))
+    for (auto chunk : Blocks(input))
     {
         ++pairIndex;
 
@@ -167,7 +167,7 @@ static std::vector<Packet> ParsePackets(std::string_view input)
     packets.push_back(ParsePacket("[[2]]", true));
     packets.push_back(ParsePacket("[[6]]", true));
 
-    for (auto line : Split(input, '\n'))
+    for (auto line : Lines(input))
     {
         if (line.empty())
         {
@@ -220,19 +220,23 @@ static auto Part2()
     return FindDecoderKey(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/13
-    std::println("Day 13, 2022: Distress Signal");
+    puzzle.Title(2022, 13, "Distress Signal");
 
     Assert(13 == SumOrderedPairs(example::signal));
     Assert(140 == FindDecoderKey(example::signal));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(6484 == part1);
+    puzzle.Part(1, 6484,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(19'305 == part2);
+    puzzle.Part(2, 19'305,
+        []
+        {
+            return Part2();
+        });
 }
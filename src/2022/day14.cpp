@@ -1,6 +1,7 @@
 #include "day14.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/grid2d.hpp"
 
 struct Line
 {
@@ -12,21 +13,19 @@ static constexpr Point2d const dropLocation{500, 0};
 
 struct Map
 {
-    std::unordered_map<Point2d, char> grid;
+    static constexpr char Air = '.';
+    static constexpr char Rock = '#';
+    static constexpr char Crack = '+';
+    static constexpr char Sand = 'o';
+
+    Grid2d<char> grid = Grid2d<char>::Unbounded(Air, Air);
     int floorHeight = 0;
-    Point2d min = dropLocation;
-    Point2d max = dropLocation;
 
     Map()
     {
-        grid[dropLocation] = Crack;
+        grid.Grow(dropLocation) = Crack;
     }
 
-    static constexpr char Air = '.';
-    static constexpr char Rock = '#';
-    static constexpr char Crack = '+';
-    static constexpr char Sand = 'o';
-
     static Point2d ParsePoint(std::string_view point)
     {
         auto const parts = Split(point, ',');
@@ -43,7 +42,7 @@ struct Map
 
     void ParseScanLines(std::string_view scanlines)
     {
-        for (auto line : Split(scanlines, '\n'))
+        for (auto line : Lines(scanlines))
         {
             if (line.empty())
             {
@@ -96,37 +95,24 @@ struct Map
 
     void SetCell(Point2d p, char value)
     {
-        grid[p] = value;
-
-        min.x = std::min(min.x, p.x);
-        min.y = std::min(min.y, p.y);
-        max.x = std::max(max.x, p.x);
-        max.y = std::max(max.y, p.y);
+        grid.Grow(p) = value;
     }
 
     char GetCell(Point2d pos) const
     {
-        if (auto iter = grid.find(pos); iter != end(grid))
-        {
-            return iter->second;
-        }
-
-        return Air;
+        return grid.Get(pos);
     }
 
     void Draw() const
     {
-        int const w = max.x - min.x + 1;
-        int const h = max.y - min.y + 1;
-
-        for (int y = 0; y != h; ++y)
+        for (auto p : grid.Points())
         {
-            for (int x = 0; x != w; ++x)
+            std::print("{}", grid[p]);
+
+            if (p.x == grid.Max().x)
             {
-                std::print("{}", GetCell({x + min.x, y + min.y}));
+                std::println("");
             }
-
-            std::println("");
         }
     }
 
@@ -148,7 +134,7 @@ struct Map
             return State::Stop;
         }
 
-        if (candidate.y > max.y + 2)
+        if (candidate.y > grid.Max().y + 2)
         {
             return State::Drop;
         }
@@ -221,7 +207,7 @@ struct Map
 
     void AddFloor()
     {
-        floorHeight = max.y + 2;
+        floorHeight = grid.Max().y + 2;
     }
 };
 
@@ -256,19 +242,23 @@ static auto Part2()
     return Simulate(GetInput(), true);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/14
-    std::println("Day 14, 2022: Regolith Reservoir");
+    puzzle.Title(2022, 14, "Regolith Reservoir");
 
     Assert(24 == Simulate(example::scanlines, false));
     Assert(93 == Simulate(example::scanlines, true));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(728 == part1);
+    puzzle.Part(1, 728,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    // Assert( == part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
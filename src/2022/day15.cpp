@@ -34,7 +34,7 @@ static auto ParseInput(std::string_view text)
 {
     std::vector<Sensor> sensors;
 
-    for (auto line : Split(text, '\n'))
+    for (auto line : Lines(text))
     {
         auto [matched, sx, sy, bx, by] = ctre::match<"Sensor at x=(.+), y=(.+): closest beacon is at x=(.+), y=(.+)">(line);
 
@@ -97,17 +97,16 @@ static auto CountImpossible(std::string_view sensors, int y)
     return CountImpossible(ParseInput(sensors), y);
 }
 
-static int64_t FindBeacon(std::vector<Sensor> const &sensors, int limit)
+static int64_t FindBeacon(std::vector<Sensor> const &sensors, int limit, bool showProgress)
 {
     Range const limitWidth{0, limit};
-    bool const stdoutIsConsole = IsTerminal(stdout);
 
     // force brute ... il doit y avoir une meilleure solution
     for (int y = limit; y >= 0; --y)
     {
         std::vector<Range> ranges;
 
-        if (stdoutIsConsole && y % 10'000 == 0)
+        if (showProgress && y % 10'000 == 0)
         {
             std::print("  {}/{} {}%          \r", y, limit, 100 - (y * 100LL / limit));
         }
@@ -143,9 +142,9 @@ static int64_t FindBeacon(std::vector<Sensor> const &sensors, int limit)
     return 0;
 }
 
-static auto FindBeacon(std::string_view sensors, int limit)
+static auto FindBeacon(std::string_view sensors, int limit, bool showProgress = false)
 {
-    return FindBeacon(ParseInput(sensors), limit);
+    return FindBeacon(ParseInput(sensors), limit, showProgress);
 }
 
 static auto Part1()
@@ -153,24 +152,28 @@ static auto Part1()
     return CountImpossible(GetInput(), 2'000'000);
 }
 
-static auto Part2()
+static auto Part2(bool showProgress)
 {
-    return FindBeacon(GetInput(), 4'000'000);
+    return FindBeacon(GetInput(), 4'000'000, showProgress);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/15
-    std::println("Day 15, 2022: Beacon Exclusion Zone");
+    puzzle.Title(2022, 15, "Beacon Exclusion Zone");
 
     Assert(26 == CountImpossible(example::beacons, 10));
     Assert(56'000'011 == FindBeacon(example::beacons, 20));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(5'525'847 == part1);
+    puzzle.Part(1, 5'525'847,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(13'340'867'187'704 == part2);
+    puzzle.Part(2, 13'340'867'187'704,
+        [&puzzle]
+        {
+            return Part2(puzzle.IsInteractive());
+        });
 }
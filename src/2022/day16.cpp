@@ -12,16 +12,20 @@ static auto Part2()
     return 0;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/16
-    std::println("Day 16, 2022: Proboscidea Volcanium");
+    puzzle.Title(2022, 16, "Proboscidea Volcanium");
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    // Assert( == part1);
+    puzzle.Part(1,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    // Assert( == part2);
+    puzzle.Part(2,
+        []
+        {
+            return Part2();
+        });
 }
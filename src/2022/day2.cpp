@@ -154,19 +154,27 @@ static int Part2(std::string_view lines)
     return TransformReduceLines(lines, 0, std::plus{}, &Score2);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/2
-    std::println("Day 2, 2022: Rock Paper Scissors");
+    puzzle.Title(2022, 2, "Rock Paper Scissors");
 
     Assert(15 == Part1(example::lines));
     Assert(12 == Part2(example::lines));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(12'740 == part1);
-
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(11'980 == part2);
+    // nothing but views on the input
+    puzzle.AllocationBudget(1, 0);
+    puzzle.AllocationBudget(2, 0);
+
+    puzzle.Part(1, 12'740,
+        []
+        {
+            return Part1(GetInput());
+        });
+
+    puzzle.Part(2, 11'980,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
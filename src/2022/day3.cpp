@@ -77,19 +77,23 @@ static int Part2()
     return ParseGroups(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/3
-    std::println("Day 3, 2022: Rucksack Reorganization");
+    puzzle.Title(2022, 3, "Rucksack Reorganization");
 
     Assert(157 == PraseLines(example::rucksack));
     Assert(70 == ParseGroups(example::rucksack));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(8401 == part1);
-
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2641 == part2);
+    puzzle.Part(1, 8401,
+        []
+        {
+            return Part1();
+        });
+
+    puzzle.Part(2, 2641,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,18 +1,13 @@
 #include "day4.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/extract.hpp"
 #include "../cpp-utils/range.hpp"
 
-static Range ParseRange(std::string_view range)
-{
-    auto const parts = Split(range, '-');
-    return {svtoi(parts[0]), svtoi(parts[1])};
-}
-
 static std::pair<Range, Range> ParseRanges(std::string_view ranges)
 {
-    auto const elves = Split(ranges, ',');
-    return {ParseRange(elves[0]), ParseRange(elves[1])};
+    auto const [low1, high1, low2, high2] = *Extract<"{}-{},{}-{}", int, int, int, int>(ranges);
+    return {Range{low1, high1}, Range{low2, high2}};
 }
 
 static bool FullOverlap(std::string_view pair)
@@ -47,19 +42,27 @@ static int Part2()
     return CountAnyOverlap(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/4
-    std::println("Day 4, 2022: Camp Cleanup");
+    puzzle.Title(2022, 4, "Camp Cleanup");
 
     Assert(2 == CountFullOverlap(example::pairs));
     Assert(4 == CountAnyOverlap(example::pairs));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(424 == part1);
+    // nothing but views on the input
+    puzzle.AllocationBudget(1, 0);
+    puzzle.AllocationBudget(2, 0);
+
+    puzzle.Part(1, 424,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(804 == part2);
+    puzzle.Part(2, 804,
+        []
+        {
+            return Part2();
+        });
 }
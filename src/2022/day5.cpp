@@ -89,7 +89,7 @@ static std::string ProcessStacks(std::string_view text)
     std::vector<std::vector<char>> stacks;
     bool parseCrates = true;
 
-    for (auto line : Split(text, '\n'))
+    for (auto line : Lines(text))
     {
         if (parseCrates)
         {
@@ -125,19 +125,23 @@ static std::string Part2()
     return ProcessStacks<Crane::Mover9001>(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/5
-    std::println("Day 5, 2022: Supply Stacks");
+    puzzle.Title(2022, 5, "Supply Stacks");
 
     Assert("CMZ" == ProcessStacks<Crane::Mover9000>(example::text));
     Assert("MCD" == ProcessStacks<Crane::Mover9001>(example::text));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert("SHMSDGZVC" == part1);
+    puzzle.Part(1, "SHMSDGZVC",
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert("VRZGHDFBQ" == part2);
+    puzzle.Part(2, "VRZGHDFBQ",
+        []
+        {
+            return Part2();
+        });
 }
@@ -38,10 +38,10 @@ static int64_t Part2()
     return FindMarker(GetInput(), 14);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/6
-    std::println("Day 6, 2022: Tuning Trouble");
+    puzzle.Title(2022, 6, "Tuning Trouble");
 
     Assert(7 == FindMarker(example::data1, 4));
     Assert(5 == FindMarker(example::data2, 4));
@@ -55,11 +55,15 @@ int main()
     Assert(29 == FindMarker(example::data4, 14));
     Assert(26 == FindMarker(example::data5, 14));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(1953 == part1);
+    puzzle.Part(1, 1953,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2301 == part2);
+    puzzle.Part(2, 2301,
+        []
+        {
+            return Part2();
+        });
 }
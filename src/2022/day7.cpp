@@ -116,7 +116,7 @@ struct Terminal
 
     void ParseTerminalOutput(std::string_view text)
     {
-        for (auto line : Split(text, '\n'))
+        for (auto line : Lines(text))
         {
             ParseTerminalLine(line);
         }
@@ -206,19 +206,23 @@ static auto Part2()
     return GetSizeOfFolderToDelete(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/7
-    std::println("Day 7, 2022: No Space Left On Device"sv);
+    puzzle.Title(2022, 7, "No Space Left On Device");
 
     Assert(95'437 == SumOfAllSmallDirectories(example::terminal));
     Assert(24'933'642 == GetSizeOfFolderToDelete(example::terminal));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}"sv, part1);
-    Assert(1'428'881 == part1);
+    puzzle.Part(1, 1'428'881,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}"sv, part2);
-    Assert(10'475'598 == part2);
+    puzzle.Part(2, 10'475'598,
+        []
+        {
+            return Part2();
+        });
 }
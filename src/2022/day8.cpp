@@ -1,35 +1,20 @@
 #include "day8.hpp"
 
 #include "../cpp-utils.hpp"
-
-struct Tree
-{
-    int8_t height = 0;
-    bool visible = true;
-};
+#include "../cpp-utils/gridview.hpp"
 
 struct Map
 {
-    std::unordered_map<Point2d, Tree> grid;
+    GridView grid;
     int width = 0;
     int height = 0;
 
-    Tree &operator[](Point2d const &p)
-    {
-        return grid[p];
-    }
-
     int8_t GetHeight(Point2d pos) const
     {
-        if (auto iter = grid.find(pos); iter != end(grid))
-        {
-            return iter->second.height;
-        }
-
-        throw std::invalid_argument("pos");
+        return static_cast<int8_t>(grid[pos] - '0');
     }
 
-    bool IsVisible(Point2d pos, Point2d dir)
+    bool IsVisible(Point2d pos, Point2d dir) const
     {
         auto const h = GetHeight(pos);
         int8_t other = 0;
@@ -87,51 +72,23 @@ struct Map
         return CountSmaller(h, pos, Point2d::WEST) * CountSmaller(h, pos, Point2d::NORTH)
             * CountSmaller(h, pos, Point2d::EAST) * CountSmaller(h, pos, Point2d::SOUTH);
     }
-
-    int CountVisible() const
-    {
-        int count = 0;
-
-        for (auto const &[_, tree] : grid)
-        {
-            if (tree.visible)
-            {
-                ++count;
-            }
-        }
-
-        return count;
-    }
 };
 
 static auto ParseMap(std::string_view mapText)
 {
     Map map;
-    int y = 0;
-    int w = 0;
-
-    for (auto line : Split(mapText, '\n'))
-    {
-        int x = 0;
-
-        for (char c : line)
-        {
-            map[{x, y}] = Tree{static_cast<int8_t>(c - '0')};
-            ++x;
-        }
-
-        w = std::max(w, x);
-        ++y;
-    }
-
-    map.width = w;
-    map.height = y;
+    map.grid = GridView{mapText};
+    map.width = map.grid.Width();
+    map.height = map.grid.Height();
     return map;
 }
 
 static int CountVisibleTrees(std::string_view mapText)
 {
-    auto map = ParseMap(mapText);
+    auto const map = ParseMap(mapText);
+
+    // the trees on the edge are all visible
+    int count = map.width * map.height;
 
     for (int y = 1; y != map.height - 1; ++y)
     {
@@ -145,16 +102,16 @@ static int CountVisibleTrees(std::string_view mapText)
                 continue;
             }
 
-            map[pos].visible = false;
+            --count;
         }
     }
 
-    return map.CountVisible();
+    return count;
 }
 
 static int GetBestScore(std::string_view mapText)
 {
-    auto map = ParseMap(mapText);
+    auto const map = ParseMap(mapText);
     int score = 0;
 
     for (int y = 0; y != map.height; ++y)
@@ -178,19 +135,23 @@ static int Part2()
     return GetBestScore(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/8
-    std::println("Day 8, 2022: Treetop Tree House");
+    puzzle.Title(2022, 8, "Treetop Tree House");
 
     Assert(21 == CountVisibleTrees(example::map));
     Assert(8 == GetBestScore(example::map));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(1708 == part1);
+    puzzle.Part(1, 1708,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(504'000 == part2);
+    puzzle.Part(2, 504'000,
+        []
+        {
+            return Part2();
+        });
 }
@@ -1,6 +1,7 @@
 #include "day9.hpp"
 
 #include "../cpp-utils.hpp"
+#include "../cpp-utils/grid2d.hpp"
 
 struct Instruction
 {
@@ -29,7 +30,7 @@ static std::vector<Instruction> ParseInstructions(std::string_view text)
 {
     std::vector<Instruction> instructions;
 
-    for (auto line : Split(text, '\n'))
+    for (auto line : Lines(text))
     {
         char const dir = line[0];
         int len = svtoi(line.substr(2));
@@ -41,13 +42,13 @@ static std::vector<Instruction> ParseInstructions(std::string_view text)
 
 struct Map
 {
-    std::unordered_map<Point2d, char> grid;
+    Grid2d<char> grid = Grid2d<char>::Unbounded(' ', ' ');
     std::vector<Point2d> rope;
 
     Map(size_t knots)
         : rope(knots)
     {
-        grid[rope.back()] = '#';
+        grid.Grow(rope.back()) = '#';
     }
 
     void Run(std::string_view instructions)
@@ -84,60 +85,25 @@ struct Map
             *iter = *prev + delta;
         }
 
-        grid[rope.back()] = '#';
+        grid.Grow(rope.back()) = '#';
     }
 
     void Print() const
     {
-        int minX = std::numeric_limits<int>::max();
-        int maxX = std::numeric_limits<int>::min();
-        int minY = std::numeric_limits<int>::max();
-        int maxY = std::numeric_limits<int>::min();
-
-        for (auto const &[p, _] : grid)
+        for (auto p : grid.Points())
         {
-            minX = std::min(p.x, minX);
-            maxX = std::max(p.x, maxX);
-            minY = std::min(p.y, minY);
-            maxY = std::max(p.y, maxY);
-        }
+            std::print("{}", grid[p]);
 
-        int const w = maxX - minX + 1;
-        int const h = maxY - minY + 1;
-
-        for (int y = 0; y != h; ++y)
-        {
-            for (int x = 0; x != w; ++x)
+            if (p.x == grid.Max().x)
             {
-                Point2d p{x + minX, y + minY};
-
-                if (auto iter = grid.find(p); iter != end(grid))
-                {
-                    std::print("{}", iter->second);
-                }
-                else
-                {
-                    std::print(" ");
-                }
+                std::println("");
             }
-
-            std::println("");
         }
     }
 
     int CountVisited() const
     {
-        int count = 0;
-
-        for (auto const &[_, cell] : grid)
-        {
-            if (cell == '#')
-            {
-                ++count;
-            }
-        }
-
-        return count;
+        return static_cast<int>(grid.Count('#'));
     }
 };
 
@@ -158,20 +124,24 @@ static int Part2()
     return CountVisited(GetInput(), 10);
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2022/day/9
-    std::println("Day 9, 2022: Rope Bridge");
+    puzzle.Title(2022, 9, "Rope Bridge");
 
     Assert(13 == CountVisited(example::instructions, 2));
     Assert(1 == CountVisited(example::instructions, 10));
     Assert(36 == CountVisited(example::larger, 10));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(5513 == part1);
+    puzzle.Part(1, 5513,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(2427 == part2);
+    puzzle.Part(2, 2427,
+        []
+        {
+            return Part2();
+        });
 }
@@ -8,7 +8,7 @@ static auto Part1(std::string_view lines)
 {
     int total = 0;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         char first = '\0';
         char last = '\0';
@@ -129,7 +129,7 @@ static auto Part2(std::string_view lines)
 {
     int64_t total = 0;
 
-    for (auto line : Split(lines, '\n'))
+    for (auto line : Lines(lines))
     {
         total += GetCalibration2(line);
     }
@@ -137,10 +137,10 @@ static auto Part2(std::string_view lines)
     return total;
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/1
-    std::println("Day 1, 2023: Trebuchet?!");
+    puzzle.Title(2023, 1, "Trebuchet?!");
 
     Assert(142 == Part1(example::part1));
     Assert(281 == Part2(example::part2));
@@ -152,11 +152,15 @@ int main()
     Assert(14 == GetCalibration2(Split(example::part2, '\n')[5]));
     Assert(76 == GetCalibration2(Split(example::part2, '\n')[6]));
 
-    auto const part1 = Part1(GetInput());
-    std::println("  Part 1: {}", part1);
-    Assert(54'632 == part1);
+    puzzle.Part(1, 54'632,
+        []
+        {
+            return Part1(GetInput());
+        });
 
-    auto const part2 = Part2(GetInput());
-    std::println("  Part 2: {}", part2);
-    Assert(54'019 == part2);
+    puzzle.Part(2, 54'019,
+        []
+        {
+            return Part2(GetInput());
+        });
 }
@@ -25,7 +25,7 @@ struct SetOfCubes
 
     explicit SetOfCubes(std::string_view text)
     {
-        for (auto dice : Split(trim_copy(text), ','))
+        for (auto dice : Fields(trim_copy(text), ','))
         {
             auto const parts = Split(trim_copy(dice), ' ');
 
@@ -54,7 +54,7 @@ static constexpr SetOfCubes bag{12, 13, 14};
 
 static bool IsGamePossible(std::string_view game)
 {
-    for (auto draw : Split(game, ';'))
+    for (auto draw : Fields(game, ';'))
     {
         SetOfCubes const cubes{draw};
         if (cubes.red > bag.red || cubes.green > bag.green || cubes.blue > bag.blue)
@@ -70,7 +70,7 @@ static int CountPossibleGames(std::string_view records)
 {
     int total = 0;
 
-    for (auto record : Split(records, '\n'))
+    for (auto record : Lines(records))
     {
         auto const gameAndCubes = Split(record, ':');
 
@@ -93,7 +93,7 @@ int64_t GetPower(std::string_view record)
     auto const gameAndCubes = Split(record, ':');
     SetOfCubes max;
 
-    for (auto draw : Split(gameAndCubes[1], ';'))
+    for (auto draw : Fields(gameAndCubes[1], ';'))
     {
         SetOfCubes const cubes{draw};
         max.red = std::max(max.red, cubes.red);
@@ -108,7 +108,7 @@ static auto SumOfPowers(std::string_view records)
 {
     int64_t total = 0;
 
-    for (auto record : Split(records, '\n'))
+    for (auto record : Lines(records))
     {
         total += GetPower(record);
     }
@@ -121,20 +121,24 @@ static auto Part2()
     return SumOfPowers(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/2
-    std::println("Day 2, 2023: Cube Conundrum");
+    puzzle.Title(2023, 2, "Cube Conundrum");
 
     Assert(8 == CountPossibleGames(example::records));
     Assert(48 == GetPower(Split(example::records, '\n')[0]));
     Assert(2286 == SumOfPowers(example::records));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(2101 == part1);
+    puzzle.Part(1, 2101,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(58'269 == part2);
+    puzzle.Part(2, 58'269,
+        []
+        {
+            return Part2();
+        });
 }
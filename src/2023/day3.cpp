@@ -1,8 +1,8 @@
 #include "day3.hpp"
 
 #include "../cpp-utils.hpp"
-
-#include <unordered_map>
+#include "../cpp-utils/grid2d.hpp"
+#include "../cpp-utils/gridview.hpp"
 
 static bool IsSymbol(char c)
 {
@@ -16,37 +16,27 @@ static bool IsSymbol(char c)
 
 struct Grid
 {
-    std::unordered_map<Point2d, char> grid;
-    std::unordered_map<Point2d, size_t> partNumber;
+    static constexpr size_t kInvalid = static_cast<size_t>(-1);
+
+    GridView grid;
+    Grid2d<size_t> partNumber;
     std::vector<int> partNumbers;
     int w = 0;
     int h = 0;
 
     void ParseSchematic(std::string_view text)
     {
-        int y = 0;
-
-        for (auto line : Split(text, '\n'))
-        {
-            int x = 0;
-
-            for (char c : line)
-            {
-                grid[Point2d{x, y}] = c;
-                ++x;
-                w = std::max(w, x);
-            }
-
-            ++y;
-            h = std::max(h, y);
-        }
+        grid = GridView{text, '.'};
+        w = grid.Width();
+        h = grid.Height();
+        partNumber = Grid2d<size_t>{w, h, kInvalid, kInvalid};
     }
 
     void ParsePartNumbers()
     {
         std::string numberText;
         Point2d lastNumber;
-        std::unordered_set<Point2d> numberCoords;
+        std::vector<Point2d> numberCoords;
 
         for (int y = 0; y != h; ++y)
         {
@@ -58,7 +48,7 @@ struct Grid
                 if (std::isdigit(c))
                 {
                     numberText.append(1, c);
-                    numberCoords.insert(p);
+                    numberCoords.push_back(p);
                     lastNumber = p;
                 }
                 else if (not numberText.empty())
@@ -117,12 +107,7 @@ struct Grid
 
     char GetCell(Point2d p) const
     {
-        if (auto iter = grid.find(p); iter != end(grid))
-        {
-            return iter->second;
-        }
-
-        return '.';
+        return grid.Get(p);
     }
 
     auto GetGearRatios() const
@@ -140,7 +125,6 @@ struct Grid
                     continue;
                 }
 
-                static constexpr size_t kInvalid = static_cast<size_t>(-1);
                 size_t a = kInvalid;
                 size_t b = kInvalid;
 
@@ -153,23 +137,23 @@ struct Grid
                             continue;
                         }
 
-                        if (auto iter = partNumber.find(p + Point2d{xx, yy}); iter != end(partNumber))
+                        if (auto const index = partNumber.Get(p + Point2d{xx, yy}); index != kInvalid)
                         {
                             if (a == kInvalid)
                             {
-                                a = iter->second;
+                                a = index;
                             }
                             else if (b == kInvalid)
                             {
-                                if (a != iter->second)
+                                if (a != index)
                                 {
-                                    b = iter->second;
+                                    b = index;
                                 }
                             }
                             else
                             {
                                 // there should never be 3 part numbers near a gear
-                                Assert(b == iter->second);
+                                Assert(b == index);
                             }
                         }
                     }
@@ -212,19 +196,23 @@ static auto Part2()
     return GetGearRatios(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/3
-    std::println("Day 3, 2023: Gear Ratios");
+    puzzle.Title(2023, 3, "Gear Ratios");
 
     Assert(4361 == SumOfPartNumber(example::schematic));
     Assert(467'835 == GetGearRatios(example::schematic));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(527'364 == part1);
+    puzzle.Part(1, 527'364,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(79'026'871 == part2);
+    puzzle.Part(2, 79'026'871,
+        []
+        {
+            return Part2();
+        });
 }
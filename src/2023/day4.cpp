@@ -16,7 +16,7 @@ struct Card
         auto const winnerAndMine = Split(idAndNumbers[1], '|');
 
         std::unordered_set<int> winners;
-        for (auto numberText : Split(trim_copy(winnerAndMine[0]), ' '))
+        for (auto numberText : Fields(trim_copy(winnerAndMine[0]), ' '))
         {
             if (numberText.empty())
             {
@@ -26,7 +26,7 @@ struct Card
             winners.insert(svtoi(numberText));
         }
 
-        for (auto numberText : Split(trim_copy(winnerAndMine[1]), ' '))
+        for (auto numberText : Fields(trim_copy(winnerAndMine[1]), ' '))
         {
             if (numberText.empty())
             {
@@ -60,7 +60,7 @@ static std::vector<Card> ParseCards(std::string_view cards)
 {
     std::vector<Card> result;
 
-    for (auto line : Split(cards))
+    for (auto line : Lines(cards))
     {
         result.emplace_back(line);
     }
@@ -113,19 +113,23 @@ static auto Part2()
     return CountWinningCards(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/4
-    std::println("Day 4, 2023: Scratchcards");
+    puzzle.Title(2023, 4, "Scratchcards");
 
     Assert(13 == GetTotal(example::cards));
     Assert(30 == CountWinningCards(example::cards));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(24'848 == part1);
+    puzzle.Part(1, 24'848,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(7'258'152 == part2);
+    puzzle.Part(2, 7'258'152,
+        []
+        {
+            return Part2();
+        });
 }
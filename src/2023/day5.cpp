@@ -37,7 +37,7 @@ struct Mapping
 
     Mapping(std::string_view text)
     {
-        for (auto line : Split(text))
+        for (auto line : Lines(text))
         {
             ranges.emplace_back(line);
         }
@@ -147,11 +147,11 @@ struct Almanac
     {
         Mapping *mapping = nullptr;
 
-        for (auto line : Split(text))
+        for (auto line : Lines(text))
         {
             if (seeds.empty())
             {
-                for (auto seed : Split(line.substr(7), ' '))
+                for (auto seed : Fields(line.substr(7), ' '))
                 {
                     seeds.push_back(svtoi<integer>(seed));
                 }
@@ -309,19 +309,23 @@ static auto Part2()
     return GetLowestLocationFromSeedRanges(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/5
-    std::println("Day 5, 2023: If You Give A Seed A Fertilizer");
+    puzzle.Title(2023, 5, "If You Give A Seed A Fertilizer");
 
     Assert(35 == GetLowestLocation(example::almanac));
     Assert(46 == GetLowestLocationFromSeedRanges(example::almanac));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(389'056'265 == part1);
+    puzzle.Part(1, 389'056'265,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(137'516'820 == part2);
+    puzzle.Part(2, 137'516'820,
+        []
+        {
+            return Part2();
+        });
 }
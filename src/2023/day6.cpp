@@ -37,7 +37,7 @@ static std::vector<Race> ParseRaces(std::string_view text)
 
     std::vector<Race> races;
 
-    for (auto time : Split(times, ' '))
+    for (auto time : Fields(times, ' '))
     {
         if (time.empty())
         {
@@ -51,7 +51,7 @@ static std::vector<Race> ParseRaces(std::string_view text)
     trim(distances);
 
     auto iter = begin(races);
-    for (auto distance : Split(distances, ' '))
+    for (auto distance : Fields(distances, ' '))
     {
         if (distance.empty())
         {
@@ -120,19 +120,23 @@ static auto Part2()
     return CalculateMargin2(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/6
-    std::println("Day 6, 2023: Wait For It");
+    puzzle.Title(2023, 6, "Wait For It");
 
     Assert(288 == CalculateMargin(example::races));
     Assert(71'503 == CalculateMargin2(example::races));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(293'046 == part1);
+    puzzle.Part(1, 293'046,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(35'150'181 == part2);
+    puzzle.Part(2, 35'150'181,
+        []
+        {
+            return Part2();
+        });
 }
@@ -166,7 +166,7 @@ static HandType GetHandTypeJoker(Hand const &hand)
 static auto GetTotalWinnings(std::string_view text)
 {
     std::vector<Hand> hands;
-    for (auto line : Split(text))
+    for (auto line : Lines(text))
     {
         hands.emplace_back(line, false);
     }
@@ -191,7 +191,7 @@ static auto Part1()
 static auto GetTotalWinningsWithJoker(std::string_view text)
 {
     std::vector<Hand> hands;
-    for (auto line : Split(text))
+    for (auto line : Lines(text))
     {
         hands.emplace_back(line, true);
     }
@@ -213,19 +213,23 @@ static auto Part2()
     return GetTotalWinningsWithJoker(GetInput());
 }
 
-int main()
+void Solve(Puzzle &puzzle)
 {
     // https://adventofcode.com/2023/day/7
-    std::println("Day 7, 2023: Camel Cards");
+    puzzle.Title(2023, 7, "Camel Cards");
 
     Assert(6440 == GetTotalWinnings(example::hands));
     Assert(5905 == GetTotalWinningsWithJoker(example::hands));
 
-    auto const part1 = Part1();
-    std::println("  Part 1: {}", part1);
-    Assert(253'910'319 == part1);
+    puzzle.Part(1, 253'910'319,
+        []
+        {
+            return Part1();
+        });
 
-    auto const part2 = Part2();
-    std::println("  Part 2: {}", part2);
-    Assert(254'083'736 == part2);
+    puzzle.Part(2, 254'083'736,
+        []
+        {
+            return Part2();
+        });
 }
@@ -3,6 +3,7 @@
 #include "cpp-utils/assert.hpp"
 #include "cpp-utils/input.hpp"
 #include "cpp-utils/point2d.hpp"
+#include "cpp-utils/puzzle.hpp"
 #include "cpp-utils/string.hpp"
 #include "cpp-utils/terminal.hpp"
 #include "cpp-utils/utils.hpp"
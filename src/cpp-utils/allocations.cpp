@@ -0,0 +1,106 @@
+#include "allocations.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+struct AllocationCounters
+{
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+    std::ptrdiff_t live = 0;
+    std::ptrdiff_t peak = 0;
+};
+
+// per thread, so that parts solved concurrently are counted separately
+static thread_local AllocationCounters counters;
+
+// every block starts with its size, so that delete knows how much memory is released;
+// the header keeps the alignment malloc gives
+static constexpr std::size_t headerSize = alignof(std::max_align_t);
+static_assert(headerSize >= sizeof(std::size_t));
+
+std::size_t GetAllocationCount()
+{
+    return counters.count;
+}
+
+AllocationScope::AllocationScope()
+    : count_{counters.count}
+    , bytes_{counters.bytes}
+    , live_{counters.live}
+    , outerPeak_{counters.peak}
+{
+    counters.peak = counters.live;
+}
+
+AllocationScope::~AllocationScope()
+{
+    counters.peak = std::max(counters.peak, outerPeak_);
+}
+
+AllocationStats AllocationScope::Stats() const
+{
+    return {
+        counters.count - count_,
+        counters.bytes - bytes_,
+        static_cast<std::size_t>(std::max<std::ptrdiff_t>(counters.peak - live_, 0)),
+    };
+}
+
+// The array and nothrow forms forward to these by default
+void *operator new(std::size_t size)
+{
+    if (size > std::numeric_limits<std::size_t>::max() - headerSize)
+    {
+        throw std::bad_alloc{};
+    }
+
+    while (true)
+    {
+        // NOLINTNEXTLINE: cppcoreguidelines-no-malloc
+        if (auto *block = static_cast<std::byte *>(std::malloc(headerSize + size)); block != nullptr)
+        {
+            std::memcpy(block, &size, sizeof(size));
+
+            ++counters.count;
+            counters.bytes += size;
+            counters.live += static_cast<std::ptrdiff_t>(size);
+            counters.peak = std::max(counters.peak, counters.live);
+
+            return block + headerSize; // NOLINT: cppcoreguidelines-pro-bounds-pointer-arithmetic
+        }
+
+        auto const handler = std::get_new_handler();
+
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+
+        handler();
+    }
+}
+
+void operator delete(void *ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    auto *const block = static_cast<std::byte *>(ptr) - headerSize; // NOLINT: cppcoreguidelines-pro-bounds-pointer-arithmetic
+    std::size_t size = 0;
+    std::memcpy(&size, block, sizeof(size));
+    counters.live -= static_cast<std::ptrdiff_t>(size);
+
+    // NOLINTNEXTLINE: cppcoreguidelines-no-malloc
+    std::free(block);
+}
+
+void operator delete(void *ptr, std::size_t /*size*/) noexcept
+{
+    operator delete(ptr);
+}
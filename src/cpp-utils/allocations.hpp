@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+
+// Number of calls to the global operator new made by the calling thread so far.
+// Counting is done by the replacement operators defined in allocations.cpp.
+[[nodiscard]] std::size_t GetAllocationCount();
+
+// What a region of code allocated through the global operator new
+struct AllocationStats
+{
+    std::size_t count = 0;
+    std::size_t bytes = 0;
+
+    // most memory held at once, on top of what was already live when the region began
+    std::size_t peakBytes = 0;
+};
+
+// Measures the allocations of the calling thread from construction on. Scopes can be
+// nested. Memory freed by another thread than the one that allocated it is not
+// credited back to the allocating thread, which can only make peaks look higher.
+class AllocationScope
+{
+    std::size_t count_;
+    std::size_t bytes_;
+    std::ptrdiff_t live_;
+    std::ptrdiff_t outerPeak_;
+
+public:
+    AllocationScope();
+    ~AllocationScope();
+
+    AllocationScope(AllocationScope const &) = delete;
+    AllocationScope &operator=(AllocationScope const &) = delete;
+
+    [[nodiscard]] AllocationStats Stats() const;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Memory handed out by bumping a pointer and released all at once, for the std::pmr
+// containers and the overloads of the helpers taking a std::pmr::memory_resource.
+// The first block is kept by Reset(): a loop resetting the arena at every iteration
+// only goes back to the heap for the iterations that need more than that block.
+class Arena
+{
+    std::unique_ptr<std::byte[]> buffer_; // NOLINT: cppcoreguidelines-avoid-c-arrays
+    std::pmr::monotonic_buffer_resource resource_;
+
+public:
+    static constexpr std::size_t defaultSize = std::size_t{1} << 16;
+
+    explicit Arena(std::size_t size = defaultSize,
+        std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : buffer_{std::make_unique_for_overwrite<std::byte[]>(size)} // NOLINT: cppcoreguidelines-avoid-c-arrays
+        , resource_{buffer_.get(), size, upstream}
+    {
+    }
+
+    Arena(Arena const &) = delete;
+    Arena &operator=(Arena const &) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource *Resource()
+    {
+        return &resource_;
+    }
+
+    // frees everything allocated since the construction or the previous reset, in O(1)
+    // for the first block; the objects living in the arena must not be used anymore
+    void Reset()
+    {
+        resource_.release();
+    }
+};
@@ -0,0 +1,71 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <format>
+
+BenchmarkStats Summarize(std::vector<BenchmarkSample> samples)
+{
+    BenchmarkStats stats;
+
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    stats.repetitions = static_cast<unsigned>(samples.size());
+
+    for (auto const &sample : samples)
+    {
+        stats.allocations.count = std::max(stats.allocations.count, sample.allocations.count);
+        stats.allocations.bytes = std::max(stats.allocations.bytes, sample.allocations.bytes);
+        stats.allocations.peakBytes = std::max(stats.allocations.peakBytes, sample.allocations.peakBytes);
+    }
+
+    std::ranges::sort(samples, {}, &BenchmarkSample::time);
+
+    // nearest rank
+    auto const rank = [&samples](std::size_t percent)
+    {
+        return samples[(samples.size() * percent + 99) / 100 - 1].time;
+    };
+
+    stats.min = samples.front().time;
+    stats.median = rank(50);
+    stats.p99 = rank(99);
+    return stats;
+}
+
+static std::string FormatDuration(std::chrono::nanoseconds time)
+{
+    using Microseconds = std::chrono::duration<double, std::micro>;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    if (time < std::chrono::milliseconds{1})
+    {
+        return std::format("{:.1f} us", Microseconds{time}.count());
+    }
+
+    return std::format("{:.3f} ms", Milliseconds{time}.count());
+}
+
+std::string FormatBytes(std::size_t bytes)
+{
+    if (bytes < 1024)
+    {
+        return std::format("{} B", bytes);
+    }
+
+    if (bytes < 1024 * 1024)
+    {
+        return std::format("{:.1f} KiB", static_cast<double>(bytes) / 1024);
+    }
+
+    return std::format("{:.1f} MiB", static_cast<double>(bytes) / (1024 * 1024));
+}
+
+std::string FormatStats(BenchmarkStats const &stats)
+{
+    return std::format("min {}, median {}, p99 {}, {} allocations, {} allocated, {} peak", FormatDuration(stats.min),
+        FormatDuration(stats.median), FormatDuration(stats.p99), stats.allocations.count,
+        FormatBytes(stats.allocations.bytes), FormatBytes(stats.allocations.peakBytes));
+}
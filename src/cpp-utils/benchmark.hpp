@@ -0,0 +1,88 @@
+#pragma once
+#include "allocations.hpp"
+#include "perf.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct BenchmarkOptions
+{
+    // untimed calls made before measuring, to warm up caches and lazy statics
+    unsigned warmup = 1;
+
+    // timed calls, at least one
+    unsigned repetitions = 10;
+};
+
+struct BenchmarkSample
+{
+    std::chrono::nanoseconds time{};
+    AllocationStats allocations;
+};
+
+struct BenchmarkStats
+{
+    unsigned repetitions = 0;
+    std::chrono::nanoseconds min{};
+    std::chrono::nanoseconds median{};
+    std::chrono::nanoseconds p99{};
+
+    // worst single call for each of the counts
+    AllocationStats allocations;
+};
+
+[[nodiscard]] BenchmarkStats Summarize(std::vector<BenchmarkSample> samples);
+[[nodiscard]] std::string FormatStats(BenchmarkStats const &stats);
+[[nodiscard]] std::string FormatBytes(std::size_t bytes);
+
+// Calls func as configured by options and returns the result of the last call. When
+// counters is set, it receives the hardware events of an average timed call.
+template <typename FuncT>
+[[nodiscard]] auto Benchmark(
+    BenchmarkOptions const &options, FuncT &func, BenchmarkStats &stats, PerfCounters *counters = nullptr)
+{
+    for (unsigned i = 0; i != options.warmup; ++i)
+    {
+        [[maybe_unused]] auto const discarded = func();
+    }
+
+    std::vector<BenchmarkSample> samples;
+    samples.reserve(std::max(options.repetitions, 1u));
+
+    auto measure = [&]()
+    {
+        std::optional<PerfScope> scope;
+
+        if (counters != nullptr)
+        {
+            scope.emplace(*counters);
+        }
+
+        AllocationScope const allocations;
+        auto const start = std::chrono::steady_clock::now();
+        auto result = func();
+        auto const stop = std::chrono::steady_clock::now();
+        samples.push_back({stop - start, allocations.Stats()});
+        return result;
+    };
+
+    auto result = measure();
+
+    for (unsigned i = 1; i < options.repetitions; ++i)
+    {
+        result = measure();
+    }
+
+    if (counters != nullptr)
+    {
+        counters->Divide(samples.size());
+    }
+
+    stats = Summarize(std::move(samples));
+    return result;
+}
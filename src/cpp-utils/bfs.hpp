@@ -0,0 +1,236 @@
+#pragma once
+#include "flathash.hpp"
+#include "grid2d.hpp"
+#include "point2d.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Visited points of a rectangle, one bit each
+class PointBitset
+{
+    Point2d min_;
+    int width_ = 0;
+    std::vector<std::uint64_t> bits_;
+
+    [[nodiscard]] std::size_t Index(Point2d p) const
+    {
+        return static_cast<std::size_t>((p.y - min_.y) * width_ + (p.x - min_.x));
+    }
+
+public:
+    PointBitset() = default;
+
+    // inclusive bounds
+    PointBitset(Point2d min, Point2d max)
+        : min_{min}
+        , width_{max.x - min.x + 1}
+        , bits_((static_cast<std::size_t>(width_) * static_cast<std::size_t>(max.y - min.y + 1) + 63) / 64)
+    {
+    }
+
+    // Unchecked: p must be in the bounds
+    [[nodiscard]] bool Contains(Point2d p) const
+    {
+        auto const index = Index(p);
+        return ((bits_[index / 64] >> (index % 64)) & 1U) != 0;
+    }
+
+    // false when p was already there
+    bool Insert(Point2d p)
+    {
+        auto const index = Index(p);
+        auto const bit = std::uint64_t{1} << (index % 64);
+        auto &word = bits_[index / 64];
+
+        if ((word & bit) != 0)
+        {
+            return false;
+        }
+
+        word |= bit;
+        return true;
+    }
+
+    void Clear()
+    {
+        std::ranges::fill(bits_, 0);
+    }
+};
+
+// Visited states of any hashable type
+template <typename State, typename Hash = std::hash<State>>
+class HashVisited
+{
+    FlatHashSet<State, Hash> states_;
+
+public:
+    [[nodiscard]] bool Contains(State const &state) const
+    {
+        return states_.contains(state);
+    }
+
+    // false when state was already there
+    bool Insert(State const &state)
+    {
+        return states_.insert(state).second;
+    }
+
+    void Clear()
+    {
+        states_.clear();
+    }
+};
+
+// Breadth-first search, one level at a time: the frontier holds the states at the current
+// distance from the sources, Step() replaces it by the states one move further, and the
+// two vectors are swapped rather than reallocated. No recursion, and every state enters a
+// frontier once.
+//
+// neighbors(state, visit) calls visit(next) for every move out of state, as for Dijkstra.
+// The visited set keeps its states between searches until Clear(): sources added after a
+// search flood what the previous ones have not reached, such as the next basin of a map.
+//
+//     Bfs<Point2d, PointBitset> bfs{PointBitset{min, max}};
+//     bfs.Add(start);
+//     bfs.Run(neighbors, [&](Point2d p, int distance) { ... });
+template <typename State, typename VisitedT = HashVisited<State>>
+class Bfs
+{
+    VisitedT visited_;
+    std::vector<State> frontier_;
+    std::vector<State> next_;
+    int distance_ = 0;
+
+public:
+    explicit Bfs(VisitedT visited = {})
+        : visited_{std::move(visited)}
+    {
+    }
+
+    // A source, at distance 0 when the frontier was empty and at the distance of the
+    // frontier otherwise; false when state was already visited
+    bool Add(State const &state)
+    {
+        if (not visited_.Insert(state))
+        {
+            return false;
+        }
+
+        if (frontier_.empty())
+        {
+            distance_ = 0;
+        }
+
+        frontier_.push_back(state);
+        return true;
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return frontier_.empty();
+    }
+
+    // distance of the frontier to the sources
+    [[nodiscard]] int Distance() const
+    {
+        return distance_;
+    }
+
+    [[nodiscard]] std::span<State const> Frontier() const
+    {
+        return frontier_;
+    }
+
+    [[nodiscard]] bool Visited(State const &state) const
+    {
+        return visited_.Contains(state);
+    }
+
+    // Moves the frontier one level further
+    template <typename NeighborsT>
+    void Step(NeighborsT &&neighbors)
+    {
+        next_.clear();
+
+        for (auto const &state : frontier_)
+        {
+            neighbors(state,
+                [this](State const &next)
+                {
+                    if (visited_.Insert(next))
+                    {
+                        next_.push_back(next);
+                    }
+                });
+        }
+
+        std::swap(frontier_, next_);
+        ++distance_;
+    }
+
+    // Calls onState(state, distance) for every state reached, level by level, until the
+    // frontier is empty or onState returns true; returns whether it did
+    template <typename NeighborsT, typename FuncT>
+    bool Run(NeighborsT &&neighbors, FuncT &&onState)
+    {
+        while (not frontier_.empty())
+        {
+            for (auto const &state : frontier_)
+            {
+                if constexpr (std::same_as<std::invoke_result_t<FuncT &, State const &, int>, bool>)
+                {
+                    if (onState(state, distance_))
+                    {
+                        return true;
+                    }
+                }
+                else
+                {
+                    onState(state, distance_);
+                }
+            }
+
+            Step(neighbors);
+        }
+
+        return false;
+    }
+
+    // forgets the visited states, the frontier and the distance
+    void Clear()
+    {
+        visited_.Clear();
+        frontier_.clear();
+        distance_ = 0;
+    }
+};
+
+// Distance of every point of the bounds to the nearest source, -1 for the points that
+// cannot be reached. neighbors must stay in the bounds.
+template <typename NeighborsT>
+[[nodiscard]] Grid2d<int> DistanceMap(Point2d min, Point2d max, std::span<Point2d const> sources, NeighborsT &&neighbors)
+{
+    Grid2d<int> distances{min, max, -1, -1};
+    Bfs<Point2d, PointBitset> bfs{PointBitset{min, max}};
+
+    for (auto source : sources)
+    {
+        bfs.Add(source);
+    }
+
+    bfs.Run(neighbors,
+        [&](Point2d p, int distance)
+        {
+            distances[p] = distance;
+        });
+
+    return distances;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Priority queue for integer priorities that never go below the last one popped, as in
+// a shortest path search with small integer weights (Dial's algorithm): one bucket per
+// priority, in a ring covering the priorities from the last one popped to the largest
+// one pushed. Push() is O(1) and Pop() moves over the empty buckets, so a search costs
+// O(edges + largest distance) instead of O(edges log nodes) with a heap.
+//
+// The ring grows to twice the spread of the priorities when a push goes beyond it. The
+// values of a bucket come out last in, first out.
+template <typename T, std::integral Priority = int>
+class BucketQueue
+{
+    std::pmr::vector<std::pmr::vector<T>> buckets_;
+    std::size_t size_ = 0;
+
+    // the last priority popped, that no push may go below: the bucket first_ holds it
+    Priority current_ = 0;
+    std::size_t first_ = 0;
+
+    [[nodiscard]] std::size_t Offset(Priority priority) const
+    {
+        return static_cast<std::size_t>(priority - current_);
+    }
+
+    [[nodiscard]] std::size_t Bucket(std::size_t offset) const
+    {
+        return (first_ + offset) & (buckets_.size() - 1);
+    }
+
+    void Grow(std::size_t spread)
+    {
+        std::pmr::vector<std::pmr::vector<T>> buckets(std::bit_ceil(spread * 2), buckets_.get_allocator());
+
+        for (std::size_t offset = 0; offset != buckets_.size(); ++offset)
+        {
+            buckets[offset] = std::move(buckets_[Bucket(offset)]);
+        }
+
+        buckets_ = std::move(buckets);
+        first_ = 0;
+    }
+
+public:
+    explicit BucketQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : buckets_{resource}
+    {
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return size_;
+    }
+
+    void Clear()
+    {
+        for (auto &bucket : buckets_)
+        {
+            bucket.clear();
+        }
+
+        size_ = 0;
+        current_ = 0;
+        first_ = 0;
+    }
+
+    void Push(Priority priority, T value)
+    {
+        if (priority < current_)
+        {
+            if (size_ != 0)
+            {
+                throw std::invalid_argument("BucketQueue: priority lower than the last one popped");
+            }
+
+            // nothing to keep in order with
+            current_ = priority;
+        }
+
+        if (Offset(priority) >= buckets_.size())
+        {
+            Grow(Offset(priority) + 1);
+        }
+
+        buckets_[Bucket(Offset(priority))].push_back(std::move(value));
+        ++size_;
+    }
+
+    // the queue must not be empty
+    std::pair<Priority, T> Pop()
+    {
+        while (buckets_[first_].empty())
+        {
+            first_ = Bucket(1);
+            ++current_;
+        }
+
+        auto value = std::move(buckets_[first_].back());
+        buckets_[first_].pop_back();
+        --size_;
+        return {current_, std::move(value)};
+    }
+};
@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+// Lock-free queue from one producer to one consumer, on the same thread or on two: a ring
+// of a fixed power-of-two capacity where each index is only written by its own side, with
+// a release store that the other side acquires. TryPush() fails when the ring is full and
+// TryPop() when it is empty, nothing ever waits.
+//
+// The indexes are on their own cache lines, so that the two threads do not share one.
+template <typename T, std::size_t Capacity = 256>
+class Channel
+{
+    static_assert(std::has_single_bit(Capacity), "the capacity must be a power of two");
+
+    static constexpr std::size_t kCacheLine = 64;
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    // next item to read, written by the consumer
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+
+    // next item to write, written by the producer
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+
+    alignas(kCacheLine) std::array<T, Capacity> items_{};
+
+public:
+    Channel() = default;
+    Channel(Channel const &) = delete;
+    Channel &operator=(Channel const &) = delete;
+
+    // producer side: false when the channel is full
+    bool TryPush(T value)
+    {
+        auto const tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail - head_.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+
+        items_[tail & kMask] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side: false when the channel is empty
+    bool TryPop(T &value)
+    {
+        auto const head = head_.load(std::memory_order_relaxed);
+
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        value = std::move(items_[head & kMask]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // exact on the consumer side, may be outdated on the other one
+    [[nodiscard]] bool Empty() const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        auto const head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    [[nodiscard]] static constexpr std::size_t MaxSize()
+    {
+        return Capacity;
+    }
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include <iterator>
 
 template <typename ContainerT, typename CallableT>
 static void ForEachCombinations(ContainerT &&cont, CallableT &&callable)
@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Directed acyclic graph of the nodes 0 to n - 1, as the ids of an Interner, where the
+// value of a node is computed from the values of its inputs: wires of a circuit, bags in
+// bags, chemicals of reactions...
+//
+// The nodes are sorted once, inputs first (Kahn's algorithm, no recursion), and a cycle
+// throws. Evaluate() then computes every value in one pass over a flat vector, each node
+// once, instead of recursive lookups with a cache.
+//
+//     Dag dag;
+//     dag.AddInput(wire, operand);
+//     auto const values = dag.Evaluate<int>([&](std::uint32_t node, std::span<int const> values) { ... });
+class Dag
+{
+    std::vector<std::vector<std::uint32_t>> inputs_;
+    std::vector<std::uint32_t> order_;
+    bool sorted_ = false;
+
+    void Sort()
+    {
+        std::vector<std::vector<std::uint32_t>> users(inputs_.size());
+        std::vector<std::size_t> pending(inputs_.size());
+
+        for (std::uint32_t node = 0; node != inputs_.size(); ++node)
+        {
+            pending[node] = inputs_[node].size();
+
+            for (auto input : inputs_[node])
+            {
+                users[input].push_back(node);
+            }
+        }
+
+        order_.clear();
+
+        for (std::uint32_t node = 0; node != inputs_.size(); ++node)
+        {
+            if (pending[node] == 0)
+            {
+                order_.push_back(node);
+            }
+        }
+
+        // order_ is the queue of the nodes whose inputs are all sorted
+        for (std::size_t i = 0; i != order_.size(); ++i)
+        {
+            for (auto user : users[order_[i]])
+            {
+                if (--pending[user] == 0)
+                {
+                    order_.push_back(user);
+                }
+            }
+        }
+
+        if (order_.size() != inputs_.size())
+        {
+            throw std::runtime_error("Dag: cycle");
+        }
+
+        sorted_ = true;
+    }
+
+public:
+    Dag() = default;
+
+    // n nodes without inputs
+    explicit Dag(std::size_t n)
+        : inputs_(n)
+    {
+    }
+
+    // adds the nodes up to n - 1
+    void Resize(std::size_t n)
+    {
+        if (n > inputs_.size())
+        {
+            inputs_.resize(n);
+            sorted_ = false;
+        }
+    }
+
+    // the value of node depends on the value of input; adds both nodes if needed
+    void AddInput(std::uint32_t node, std::uint32_t input)
+    {
+        Resize(std::size_t{std::max(node, input)} + 1);
+        inputs_[node].push_back(input);
+        sorted_ = false;
+    }
+
+    // the value of node depends on the values of inputs only, instead of its previous
+    // inputs; adds the nodes if needed
+    void SetInputs(std::uint32_t node, std::span<std::uint32_t const> inputs)
+    {
+        Resize(std::size_t{node} + 1);
+
+        for (auto input : inputs)
+        {
+            Resize(std::size_t{input} + 1);
+        }
+
+        inputs_[node].assign(inputs.begin(), inputs.end());
+        sorted_ = false;
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return inputs_.size();
+    }
+
+    [[nodiscard]] std::span<std::uint32_t const> Inputs(std::uint32_t node) const
+    {
+        return inputs_[node];
+    }
+
+    // every node after its inputs; throws std::runtime_error when there is a cycle
+    [[nodiscard]] std::span<std::uint32_t const> Order()
+    {
+        if (not sorted_)
+        {
+            Sort();
+        }
+
+        return order_;
+    }
+
+    // The value of every node, eval(node, values) returning the value of node from the
+    // values of its inputs, already computed
+    template <typename T, typename EvalT>
+    [[nodiscard]] std::vector<T> Evaluate(EvalT &&eval)
+    {
+        std::vector<T> values(inputs_.size());
+
+        for (auto node : Order())
+        {
+            values[node] = eval(node, std::span<T const>{values});
+        }
+
+        return values;
+    }
+};
@@ -1,10 +1,14 @@
 #pragma once
+#include <functional>
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
+#include <utility>
 
-template <typename KeyT, typename ValueT>
+template <typename KeyT, typename ValueT, typename AllocatorT = std::allocator<std::pair<KeyT const, ValueT>>>
 struct DictWithDefault
 {
-    std::unordered_map<KeyT, ValueT> dict;
+    std::unordered_map<KeyT, ValueT, std::hash<KeyT>, std::equal_to<KeyT>, AllocatorT> dict;
     ValueT defaultValue;
 
     explicit DictWithDefault(ValueT defaultValue_)
@@ -12,6 +16,12 @@ struct DictWithDefault
     {
     }
 
+    DictWithDefault(ValueT defaultValue_, AllocatorT const &allocator)
+        : dict(allocator)
+        , defaultValue(std::move(defaultValue_))
+    {
+    }
+
     void Set(KeyT const &key, ValueT value)
     {
         dict[key] = std::move(value);
@@ -27,3 +37,7 @@ struct DictWithDefault
         return defaultValue;
     }
 };
+
+// built from a std::pmr::memory_resource, an Arena for instance
+template <typename KeyT, typename ValueT>
+using PmrDictWithDefault = DictWithDefault<KeyT, ValueT, std::pmr::polymorphic_allocator<std::pair<KeyT const, ValueT>>>;
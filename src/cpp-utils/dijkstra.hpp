@@ -1,104 +1,339 @@
 #pragma once
-#include "defaultdict.hpp"
+#include "grid2d.hpp"
+#include "point2d.hpp"
 
-#include <type_traits>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
-template <class Map, class WeightFunction, class ValidNeighborFunction, class GoalCheckFunction>
-class Dijkstra
+// The heuristic of a search without one: A* is then Dijkstra
+struct NoHeuristic
+{
+    template <typename State>
+    [[nodiscard]] constexpr int operator()(State const & /*state*/) const noexcept
+    {
+        return 0;
+    }
+};
+
+// Binary heap, lowest priority first, for any ordered priority. BucketQueue has the same
+// interface for the searches with small integer weights.
+template <typename T, typename Priority>
+class HeapQueue
+{
+    std::pmr::vector<std::pair<Priority, T>> heap_;
+
+    // std::push_heap() keeps the largest element on top, hence the reversed order
+    [[nodiscard]] static bool Later(std::pair<Priority, T> const &a, std::pair<Priority, T> const &b)
+    {
+        return b.first < a.first;
+    }
+
+public:
+    explicit HeapQueue(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : heap_{resource}
+    {
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return heap_.empty();
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return heap_.size();
+    }
+
+    void Clear()
+    {
+        heap_.clear();
+    }
+
+    void Push(Priority priority, T value)
+    {
+        heap_.emplace_back(std::move(priority), std::move(value));
+        std::ranges::push_heap(heap_, Later);
+    }
+
+    // the queue must not be empty
+    std::pair<Priority, T> Pop()
+    {
+        std::ranges::pop_heap(heap_, Later);
+        auto top = std::move(heap_.back());
+        heap_.pop_back();
+        return top;
+    }
+};
+
+// What a search knows of a state reached: its cost so far, the state it came from, and
+// whether that cost is final
+template <typename State, typename Cost>
+struct DijkstraNode
+{
+    Cost cost{};
+    State previous{};
+    bool done = false;
+};
+
+// Nodes of the states of any hashable type
+template <typename State, typename Cost, typename Hash = std::hash<State>>
+class HashNodes
 {
-    Map const *map_;
-    WeightFunction calcWeight_;
-    ValidNeighborFunction validNeighbor_;
-    GoalCheckFunction isGoal_;
-    using Weight = std::invoke_result_t<WeightFunction, Point2d, Point2d>;
+public:
+    using Node = DijkstraNode<State, Cost>;
 
 private:
-    static void UpdatePriority(std::vector<std::tuple<Point2d, Weight>> &queue, Point2d p, Weight c)
+    std::pmr::unordered_map<State, Node, Hash> nodes_;
+
+public:
+    explicit HashNodes(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : nodes_{resource}
     {
-        std::erase_if(queue,
-            [&p](auto const &t)
-            {
-                return get<Point2d>(t) == p;
-            });
+    }
 
-        auto t = std::make_tuple(p, c);
-        auto iter = std::lower_bound(begin(queue), end(queue), t,
-            [](auto const &a, auto const &b)
-            {
-                return std::get<Weight>(b) < std::get<Weight>(a);
-            });
+    // none when state was not reached; the nodes do not move as others are added
+    [[nodiscard]] Node *Find(State const &state)
+    {
+        auto const iter = nodes_.find(state);
+        return iter != end(nodes_) ? &iter->second : nullptr;
+    }
+
+    [[nodiscard]] Node const *Find(State const &state) const
+    {
+        auto const iter = nodes_.find(state);
+        return iter != end(nodes_) ? &iter->second : nullptr;
+    }
 
-        queue.insert(iter, t);
+    // the node of state, set to node when it was not reached, and whether it was added
+    std::pair<Node *, bool> TryEmplace(State const &state, Node const &node)
+    {
+        auto const [iter, added] = nodes_.try_emplace(state, node);
+        return {&iter->second, added};
+    }
+
+    void Clear()
+    {
+        nodes_.clear();
     }
+};
 
+// Nodes of the points of a rectangle, in a grid: no hashing, for the searches that cover
+// most of a map
+template <typename Cost>
+class PointNodes
+{
 public:
-    Dijkstra(Map const &map, WeightFunction &&weightFn, ValidNeighborFunction &&validNeighborFn, GoalCheckFunction &&goalCheckFn)
-        : map_{std::addressof(map)}
-        , calcWeight_{std::move(weightFn)}
-        , validNeighbor_{std::move(validNeighborFn)}
-        , isGoal_{std::move(goalCheckFn)}
+    using Node = DijkstraNode<Point2d, Cost>;
+
+private:
+    Grid2d<Node> nodes_;
+    Grid2d<std::uint8_t> reached_;
+
+public:
+    PointNodes() = default;
+
+    // inclusive bounds
+    PointNodes(Point2d min, Point2d max)
+        : nodes_{min, max}
+        , reached_{min, max}
     {
     }
 
-    std::vector<Point2d> Solve(Point2d start)
+    // Unchecked: p must be in the bounds
+    [[nodiscard]] Node *Find(Point2d p)
     {
-        static constexpr auto limit = std::numeric_limits<Weight>::max();
-        DictWithDefault<Point2d, Weight> dist{limit};
-        std::unordered_map<Point2d, Point2d> prev;
-        std::vector<std::tuple<Point2d, Weight>> queue;
+        return reached_[p] != 0 ? &nodes_[p] : nullptr;
+    }
 
-        queue.reserve(map_->size());
+    [[nodiscard]] Node const *Find(Point2d p) const
+    {
+        return reached_[p] != 0 ? &nodes_[p] : nullptr;
+    }
 
-        for (auto const &[p, _] : *map_)
+    std::pair<Node *, bool> TryEmplace(Point2d p, Node const &node)
+    {
+        auto &slot = nodes_[p];
+
+        if (reached_[p] != 0)
+        {
+            return {&slot, false};
+        }
+
+        reached_[p] = 1U;
+        slot = node;
+        return {&slot, true};
+    }
+
+    void Clear()
+    {
+        reached_.Fill(0);
+    }
+};
+
+// Shortest paths from a start to a goal, over any hashable state. The states are only
+// generated as they are reached: neighbors(state, visit) calls visit(next, cost) for
+// every move out of state, with a non-negative cost.
+//
+// A state is pushed again in the queue whenever its cost improves, the outdated entries
+// are skipped when they come out: with the default HeapQueue each relaxation is then
+// O(log n). BucketQueue (bucketqueue.hpp) is faster for integer costs of a few units,
+// including with a heuristic since the priorities never decrease either.
+//
+// A heuristic turns the search into A*. It must never overestimate the cost left to a
+// goal, nor drop by more than the cost of a move: a state popped is then final.
+//
+// The nodes are kept in a hash map by default; PointNodes keeps them in a grid when the
+// states are the points of a known rectangle, as PointBitset does for Bfs.
+//
+//     Dijkstra<Point2d> search;
+//     auto const steps = search.Solve(start, neighbors, isExit, manhattanToExit);
+//     auto const path = search.Path(search.Goal());
+template <typename State, typename Cost = int, template <typename, typename> class Queue = HeapQueue,
+    typename NodesT = HashNodes<State, Cost>>
+class Dijkstra
+{
+    using Node = DijkstraNode<State, Cost>;
+
+    struct Entry
+    {
+        Cost cost;
+        State state;
+    };
+
+    NodesT nodes_;
+    Queue<Entry, Cost> queue_;
+    State start_{};
+    State goal_{};
+
+    template <typename NeighborsT, typename GoalT, typename HeuristicT>
+    std::optional<Cost> Run(State const &start, NeighborsT &neighbors, GoalT &isGoal, HeuristicT &heuristic)
+    {
+        nodes_.Clear();
+        queue_.Clear();
+        start_ = start;
+        nodes_.TryEmplace(start, Node{Cost{}, start});
+        queue_.Push(static_cast<Cost>(heuristic(start)), Entry{Cost{}, start});
+
+        while (not queue_.Empty())
         {
-            if (p == start)
+            auto const entry = queue_.Pop().second;
+
+            // every state in the queue has a node, that does not move as others are added
+            auto &node = *nodes_.Find(entry.state);
+
+            if (node.done || node.cost < entry.cost)
             {
                 continue;
             }
 
-            queue.push_back(std::make_tuple(p, limit));
+            node.done = true;
+
+            if (isGoal(entry.state))
+            {
+                goal_ = entry.state;
+                return entry.cost;
+            }
+
+            neighbors(entry.state,
+                [&](State const &next, Cost cost)
+                {
+                    auto const alt = entry.cost + cost;
+                    auto const [nextNode, added] = nodes_.TryEmplace(next, Node{alt, entry.state});
+
+                    if (not added)
+                    {
+                        if (nextNode->done || nextNode->cost <= alt)
+                        {
+                            return;
+                        }
+
+                        *nextNode = Node{alt, entry.state};
+                    }
+
+                    queue_.Push(alt + static_cast<Cost>(heuristic(next)), Entry{alt, next});
+                });
         }
 
-        dist.Set(start, 0);
-        queue.push_back(std::make_tuple(start, Weight{}));
+        return std::nullopt;
+    }
 
-        while (not queue.empty())
+public:
+    // the bookkeeping is allocated from resource, only the paths are returned on the heap
+    explicit Dijkstra(std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : nodes_{resource}
+        , queue_{resource}
+    {
+    }
+
+    // nodes built by the caller, such as PointNodes with its bounds; the queue is allocated
+    // from resource
+    explicit Dijkstra(NodesT nodes, std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : nodes_{std::move(nodes)}
+        , queue_{resource}
+    {
+    }
+
+    // Cost of the cheapest path to a state for which isGoal() is true, none when no goal
+    // can be reached
+    template <typename NeighborsT, typename GoalT, typename HeuristicT = NoHeuristic>
+    std::optional<Cost> Solve(State const &start, NeighborsT &&neighbors, GoalT &&isGoal, HeuristicT &&heuristic = {})
+    {
+        return Run(start, neighbors, isGoal, heuristic);
+    }
+
+    // Every state that can be reached, for Distance() and Path()
+    template <typename NeighborsT>
+    void Explore(State const &start, NeighborsT &&neighbors)
+    {
+        auto const never = [](State const & /*state*/)
         {
-            auto const &[current, d] = queue.back();
-            queue.pop_back();
+            return false;
+        };
 
-            if (isGoal_(current))
-            {
-                std::vector<Point2d> path;
+        NoHeuristic heuristic;
+        Run(start, neighbors, never, heuristic);
+    }
 
-                for (auto iter = prev.find(current); iter != end(prev);)
-                {
-                    path.push_back(iter->second);
-                    iter = prev.find(iter->second);
-                }
+    // the goal found by Solve()
+    [[nodiscard]] State const &Goal() const
+    {
+        return goal_;
+    }
 
-                return path;
-            }
+    // cost of the cheapest path to state, none when the search did not settle it
+    [[nodiscard]] std::optional<Cost> Distance(State const &state) const
+    {
+        if (auto const *node = nodes_.Find(state); node != nullptr && node->done)
+        {
+            return node->cost;
+        }
 
-            std::array const neighbors{current + Point2d::EAST, current + Point2d::SOUTH, current + Point2d::WEST,
-                current + Point2d::NORTH};
+        return std::nullopt;
+    }
 
-            for (auto neighbor : neighbors)
-            {
-                if (not validNeighbor_(current, neighbor))
-                {
-                    continue;
-                }
+    // the states from the start to state, both included; empty when state was not settled
+    [[nodiscard]] std::vector<State> Path(State const &state) const
+    {
+        std::vector<State> path;
 
-                if (auto const alt = dist.Get(current) + calcWeight_(current, neighbor); alt < dist.Get(neighbor))
-                {
-                    dist.Set(neighbor, alt);
-                    prev[neighbor] = current;
-                    UpdatePriority(queue, neighbor, alt);
-                }
-            }
+        if (not Distance(state))
+        {
+            return path;
+        }
+
+        for (auto current = state; current != start_; current = nodes_.Find(current)->previous)
+        {
+            path.push_back(current);
         }
 
-        return {};
+        path.push_back(start_);
+        std::ranges::reverse(path);
+        return path;
     }
 };
@@ -0,0 +1,159 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Text of a pattern, usable as a template argument: Extract<"<x={}, y={}>", int, int>
+template <std::size_t N>
+struct Pattern
+{
+    // NOLINTNEXTLINE: cppcoreguidelines-avoid-c-arrays, misc-non-private-member-variables-in-classes
+    char chars[N]{};
+
+    // NOLINTNEXTLINE: cppcoreguidelines-avoid-c-arrays, google-explicit-constructor
+    consteval Pattern(char const (&text)[N])
+    {
+        std::copy_n(text, N, chars);
+    }
+
+    [[nodiscard]] constexpr std::string_view View() const
+    {
+        return {chars, N - 1};
+    }
+};
+
+inline constexpr std::string_view patternPlaceholder = "{}";
+
+[[nodiscard]] consteval std::size_t CountPatternFields(std::string_view pattern)
+{
+    std::size_t count = 0;
+
+    for (auto pos = pattern.find(patternPlaceholder); pos != pattern.npos;
+         pos = pattern.find(patternPlaceholder, pos + patternPlaceholder.size()))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+// the text around the placeholders, a field is found between literals[i] and literals[i + 1]
+template <std::size_t count>
+[[nodiscard]] consteval std::array<std::string_view, count + 1> SplitPattern(std::string_view pattern)
+{
+    std::array<std::string_view, count + 1> literals{};
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        auto const pos = pattern.find(patternPlaceholder);
+        literals[i] = pattern.substr(0, pos);
+        pattern.remove_prefix(pos + patternPlaceholder.size());
+    }
+
+    literals[count] = pattern;
+    return literals;
+}
+
+template <typename T>
+concept ExtractableNumber =
+    (std::integral<T> && not std::same_as<T, bool> && not std::same_as<T, char>) || std::floating_point<T>;
+
+template <typename T>
+concept Extractable = ExtractableNumber<T> || std::same_as<T, char> || std::same_as<T, std::string_view>;
+
+// reads a field then the literal that follows it, and moves the text past both
+template <Extractable T>
+[[nodiscard]] bool ExtractField(std::string_view &text, T &field, std::string_view next)
+{
+    if constexpr (std::same_as<T, std::string_view>)
+    {
+        // as short as possible: up to the first occurrence of the next literal
+        auto const pos = next.empty() ? text.size() : text.find(next);
+
+        if (pos == text.npos)
+        {
+            return false;
+        }
+
+        field = text.substr(0, pos);
+        text.remove_prefix(pos);
+    }
+    else if constexpr (std::same_as<T, char>)
+    {
+        if (text.empty())
+        {
+            return false;
+        }
+
+        field = text.front();
+        text.remove_prefix(1);
+    }
+    else
+    {
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-bounds-pointer-arithmetic
+        auto const [end, error] = std::from_chars(text.data(), text.data() + text.size(), field);
+
+        if (error != std::errc{})
+        {
+            return false;
+        }
+
+        text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+    }
+
+    if (not text.starts_with(next))
+    {
+        return false;
+    }
+
+    text.remove_prefix(next.size());
+    return true;
+}
+
+// Parses a text laid out as the pattern, every {} standing for a field of the matching
+// type: an integer or a floating point number (as std::from_chars reads them), a char,
+// or a std::string_view that stops at the first occurrence of the text following it.
+// The whole text must match, std::nullopt is returned otherwise.
+//
+//     auto const [x, y, z] = *Extract<"<x={}, y={}, z={}>", int, int, int>(line);
+template <Pattern pattern, Extractable... Ts>
+[[nodiscard]] std::optional<std::tuple<Ts...>> Extract(std::string_view text)
+{
+    constexpr auto count = CountPatternFields(pattern.View());
+    static_assert(count == sizeof...(Ts), "the pattern and the field types do not match");
+
+    static constexpr auto literals = SplitPattern<count>(pattern.View());
+    constexpr auto isDelimited = []<std::size_t... I>(std::index_sequence<I...>)
+    {
+        // a string field needs text after it, unless it is the last one
+        return ((not std::same_as<Ts, std::string_view> || I + 1 == count || not literals[I + 1].empty()) && ...);
+    }(std::index_sequence_for<Ts...>{});
+    static_assert(isDelimited, "a {} string field must be followed by some text");
+
+    if (not text.starts_with(literals[0]))
+    {
+        return std::nullopt;
+    }
+
+    text.remove_prefix(literals[0].size());
+    std::tuple<Ts...> fields;
+
+    bool const matched = [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return (ExtractField(text, std::get<I>(fields), literals[I + 1]) && ...);
+    }(std::index_sequence_for<Ts...>{});
+
+    if (not matched || not text.empty())
+    {
+        return std::nullopt;
+    }
+
+    return fields;
+}
@@ -0,0 +1,591 @@
+#pragma once
+#include "hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AOC_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Open addressing in the manner of SwissTable: the slots are split in groups of 16, each
+// slot having a control byte that tells whether it is empty, deleted, or holds a key
+// whose hash ends with the 7 bits stored there. A lookup compares the 16 control bytes of
+// a group at once (SSE2) and only looks at the keys whose 7 bits match, then moves to
+// another group while none of the bytes is empty. Everything lives in two flat arrays.
+//
+// The slots stay constructed, so keys and values must be default constructible and
+// erase() resets them to their default; the slots of a map hold a const key, like
+// std::unordered_map, and are constructed again in place. Inserting or erasing
+// invalidates the iterators.
+
+struct FlatHashStats
+{
+    std::size_t size = 0;
+    std::size_t capacity = 0;
+    std::size_t tombstones = 0;
+
+    // groups visited to find a key: 1 when it is in the group its hash points to
+    double meanProbeLength = 0;
+    std::size_t maxProbeLength = 0;
+};
+
+template <typename Key, typename Slot, typename Hash, typename KeyEqual>
+class FlatHashTable
+{
+public:
+    static constexpr std::size_t groupSize = 16;
+
+private:
+    static constexpr std::int8_t emptySlot = -128;
+    static constexpr std::int8_t deletedSlot = -2;
+
+    std::vector<std::int8_t> control_;
+    std::vector<Slot> slots_;
+    std::size_t size_ = 0;
+    std::size_t tombstones_ = 0;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] KeyEqual equal_;
+
+    template <typename... Args>
+    static void Construct(Slot &slot, Args &&...args)
+    {
+        std::destroy_at(&slot);
+        std::construct_at(&slot, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] static Key const &KeyOf(Slot const &slot)
+    {
+        if constexpr (std::same_as<Slot, Key>)
+        {
+            return slot;
+        }
+        else
+        {
+            return slot.first;
+        }
+    }
+
+    // bit i is set when control byte i of the group equals value
+    [[nodiscard]] static std::uint32_t Match(std::int8_t const *group, std::int8_t value)
+    {
+#if defined(AOC_FLAT_HASH_SSE2)
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-type-reinterpret-cast
+        auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value))));
+#else
+        std::uint32_t mask = 0;
+
+        for (std::size_t i = 0; i != groupSize; ++i)
+        {
+            // NOLINTNEXTLINE: cppcoreguidelines-pro-bounds-pointer-arithmetic
+            mask |= static_cast<std::uint32_t>(group[i] == value) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    // empty or deleted slots, the only negative control bytes
+    [[nodiscard]] static std::uint32_t MatchAvailable(std::int8_t const *group)
+    {
+#if defined(AOC_FLAT_HASH_SSE2)
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-type-reinterpret-cast
+        auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(group));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+#else
+        std::uint32_t mask = 0;
+
+        for (std::size_t i = 0; i != groupSize; ++i)
+        {
+            // NOLINTNEXTLINE: cppcoreguidelines-pro-bounds-pointer-arithmetic
+            mask |= static_cast<std::uint32_t>(group[i] < 0) << i;
+        }
+
+        return mask;
+#endif
+    }
+
+    [[nodiscard]] std::uint64_t HashOf(Key const &key) const
+    {
+        // std::hash<int> is the identity: the bits are mixed whatever the hash
+        return MixBits(static_cast<std::uint64_t>(hash_(key)));
+    }
+
+    [[nodiscard]] static std::int8_t Tag(std::uint64_t hash)
+    {
+        return static_cast<std::int8_t>(hash & 0x7f);
+    }
+
+    [[nodiscard]] std::size_t GroupCount() const
+    {
+        return control_.size() / groupSize;
+    }
+
+    // the groups are visited in a triangular sequence, which covers all of them since
+    // their count is a power of 2; calls func(group) until it returns true
+    template <typename FuncT>
+    void Probe(std::uint64_t hash, FuncT &&func) const
+    {
+        auto const mask = GroupCount() - 1;
+        auto group = static_cast<std::size_t>(hash >> 7) & mask;
+
+        for (std::size_t step = 1; not func(group); ++step)
+        {
+            group = (group + step) & mask;
+        }
+    }
+
+    // index of the slot holding key, or npos
+    [[nodiscard]] std::size_t Find(Key const &key) const
+    {
+        if (size_ == 0)
+        {
+            return npos;
+        }
+
+        auto const hash = HashOf(key);
+        auto const tag = Tag(hash);
+        std::size_t found = npos;
+
+        Probe(hash,
+            [&](std::size_t group)
+            {
+                auto const *const control = &control_[group * groupSize];
+
+                for (auto matches = Match(control, tag); matches != 0; matches &= matches - 1)
+                {
+                    auto const index = group * groupSize + static_cast<std::size_t>(std::countr_zero(matches));
+
+                    if (equal_(KeyOf(slots_[index]), key))
+                    {
+                        found = index;
+                        return true;
+                    }
+                }
+
+                return Match(control, emptySlot) != 0;
+            });
+
+        return found;
+    }
+
+    // first empty or deleted slot on the path of hash, there must be one
+    [[nodiscard]] std::size_t FindAvailable(std::uint64_t hash) const
+    {
+        std::size_t found = npos;
+
+        Probe(hash,
+            [&](std::size_t group)
+            {
+                if (auto const available = MatchAvailable(&control_[group * groupSize]); available != 0)
+                {
+                    found = group * groupSize + static_cast<std::size_t>(std::countr_zero(available));
+                    return true;
+                }
+
+                return false;
+            });
+
+        return found;
+    }
+
+    void Rehash(std::size_t capacity)
+    {
+        auto control = std::exchange(control_, std::vector<std::int8_t>(capacity, emptySlot));
+        auto slots = std::exchange(slots_, std::vector<Slot>(capacity));
+        tombstones_ = 0;
+
+        for (std::size_t i = 0; i != control.size(); ++i)
+        {
+            if (control[i] >= 0)
+            {
+                auto const hash = HashOf(KeyOf(slots[i]));
+                auto const index = FindAvailable(hash);
+                control_[index] = Tag(hash);
+                Construct(slots_[index], std::move(slots[i]));
+            }
+        }
+    }
+
+    // at most 7/8 of the slots hold a key or a tombstone, so that probes meet empty slots
+    [[nodiscard]] static std::size_t MaxLoad(std::size_t capacity)
+    {
+        return capacity - capacity / 8;
+    }
+
+    [[nodiscard]] static std::size_t CapacityFor(std::size_t count)
+    {
+        return std::bit_ceil(std::max(groupSize, count + count / 7 + 1));
+    }
+
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    template <bool isConst>
+    class Iterator
+    {
+        using Table = std::conditional_t<isConst, FlatHashTable const, FlatHashTable>;
+
+        Table *table_ = nullptr;
+        std::size_t index_ = 0;
+
+        void SkipAvailable()
+        {
+            while (index_ != table_->control_.size() && table_->control_[index_] < 0)
+            {
+                ++index_;
+            }
+        }
+
+    public:
+        using value_type = std::conditional_t<std::same_as<Slot, Key>, Key const, Slot>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<isConst || std::same_as<Slot, Key>, Slot const &, Slot &>;
+
+        Iterator() = default;
+
+        Iterator(Table *table, std::size_t index)
+            : table_{table}
+            , index_{index}
+        {
+            SkipAvailable();
+        }
+
+        // NOLINTNEXTLINE: google-explicit-constructor
+        operator Iterator<true>() const
+            requires(not isConst)
+        {
+            return {table_, index_};
+        }
+
+        [[nodiscard]] reference operator*() const
+        {
+            return table_->slots_[index_];
+        }
+
+        [[nodiscard]] auto *operator->() const
+        {
+            return std::addressof(**this);
+        }
+
+        Iterator &operator++()
+        {
+            ++index_;
+            SkipAvailable();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(Iterator const &a, Iterator const &b)
+        {
+            return a.index_ == b.index_;
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashTable() = default;
+    FlatHashTable(FlatHashTable const &) = default;
+    FlatHashTable(FlatHashTable &&) noexcept = default;
+
+    // the slots of a map cannot be assigned, a copy is moved instead
+    FlatHashTable &operator=(FlatHashTable const &other)
+    {
+        if (this != &other)
+        {
+            *this = FlatHashTable{other};
+        }
+
+        return *this;
+    }
+
+    FlatHashTable &operator=(FlatHashTable &&) noexcept = default;
+    ~FlatHashTable() = default;
+
+    explicit FlatHashTable(std::size_t count)
+    {
+        reserve(count);
+    }
+
+    [[nodiscard]] iterator begin()
+    {
+        return {this, 0};
+    }
+
+    [[nodiscard]] iterator end()
+    {
+        return {this, control_.size()};
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return {this, 0};
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return {this, control_.size()};
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const
+    {
+        return control_.size();
+    }
+
+    void clear()
+    {
+        std::ranges::fill(control_, emptySlot);
+
+        for (auto &slot : slots_)
+        {
+            Construct(slot);
+        }
+
+        size_ = 0;
+        tombstones_ = 0;
+    }
+
+    void reserve(std::size_t count)
+    {
+        if (count > MaxLoad(capacity()) - tombstones_ || control_.empty())
+        {
+            Rehash(CapacityFor(count));
+        }
+    }
+
+    [[nodiscard]] iterator find(Key const &key)
+    {
+        auto const index = Find(key);
+        return index == npos ? end() : iterator{this, index};
+    }
+
+    [[nodiscard]] const_iterator find(Key const &key) const
+    {
+        auto const index = Find(key);
+        return index == npos ? end() : const_iterator{this, index};
+    }
+
+    [[nodiscard]] bool contains(Key const &key) const
+    {
+        return Find(key) != npos;
+    }
+
+    [[nodiscard]] std::size_t count(Key const &key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    // the slot of key, default constructed when it is added; false when it was there
+    std::pair<iterator, bool> FindOrAdd(Key const &key)
+    {
+        if (auto const index = Find(key); index != npos)
+        {
+            return {iterator{this, index}, false};
+        }
+
+        if (control_.empty())
+        {
+            Rehash(groupSize);
+        }
+        else if (size_ + tombstones_ + 1 > MaxLoad(capacity()))
+        {
+            // only tombstones to clean when the table is not that full
+            Rehash(size_ + 1 > capacity() / 2 ? capacity() * 2 : capacity());
+        }
+
+        auto const hash = HashOf(key);
+        auto const index = FindAvailable(hash);
+
+        if (control_[index] == deletedSlot)
+        {
+            --tombstones_;
+        }
+
+        control_[index] = Tag(hash);
+        ++size_;
+
+        if constexpr (std::same_as<Slot, Key>)
+        {
+            Construct(slots_[index], key);
+        }
+        else
+        {
+            Construct(slots_[index], key, typename Slot::second_type{});
+        }
+
+        return {iterator{this, index}, true};
+    }
+
+    std::size_t erase(Key const &key)
+    {
+        auto const index = Find(key);
+
+        if (index == npos)
+        {
+            return 0;
+        }
+
+        // a slot can be emptied when its group has an empty slot: a probe reaching that
+        // group stops there anyway
+        auto const group = index / groupSize;
+        control_[index] = Match(&control_[group * groupSize], emptySlot) != 0 ? emptySlot : deletedSlot;
+        tombstones_ += control_[index] == deletedSlot ? 1U : 0U;
+        Construct(slots_[index]);
+        --size_;
+        return 1;
+    }
+
+    [[nodiscard]] FlatHashStats Stats() const
+    {
+        FlatHashStats stats{.size = size_, .capacity = capacity(), .tombstones = tombstones_};
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i != control_.size(); ++i)
+        {
+            if (control_[i] < 0)
+            {
+                continue;
+            }
+
+            std::size_t length = 0;
+            Probe(HashOf(KeyOf(slots_[i])),
+                [&](std::size_t group)
+                {
+                    ++length;
+                    return group == i / groupSize;
+                });
+
+            total += length;
+            stats.maxProbeLength = std::max(stats.maxProbeLength, length);
+        }
+
+        if (size_ != 0)
+        {
+            stats.meanProbeLength = static_cast<double>(total) / static_cast<double>(size_);
+        }
+
+        return stats;
+    }
+};
+
+template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashSet : public FlatHashTable<Key, Key, Hash, KeyEqual>
+{
+    using Table = FlatHashTable<Key, Key, Hash, KeyEqual>;
+
+public:
+    using Table::Table;
+
+    FlatHashSet() = default;
+
+    FlatHashSet(std::initializer_list<Key> keys)
+        : Table{keys.size()}
+    {
+        for (auto const &key : keys)
+        {
+            insert(key);
+        }
+    }
+
+    std::pair<typename Table::iterator, bool> insert(Key const &key)
+    {
+        return this->FindOrAdd(key);
+    }
+
+    template <typename... Args>
+    std::pair<typename Table::iterator, bool> emplace(Args &&...args)
+    {
+        return this->FindOrAdd(Key(std::forward<Args>(args)...));
+    }
+};
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap : public FlatHashTable<Key, std::pair<Key const, Value>, Hash, KeyEqual>
+{
+    using Table = FlatHashTable<Key, std::pair<Key const, Value>, Hash, KeyEqual>;
+
+public:
+    using Table::Table;
+
+    Value &operator[](Key const &key)
+    {
+        return this->FindOrAdd(key).first->second;
+    }
+
+    template <typename... Args>
+    std::pair<typename Table::iterator, bool> try_emplace(Key const &key, Args &&...args)
+    {
+        auto result = this->FindOrAdd(key);
+
+        if (result.second)
+        {
+            result.first->second = Value(std::forward<Args>(args)...);
+        }
+
+        return result;
+    }
+
+    std::pair<typename Table::iterator, bool> insert(std::pair<Key, Value> const &element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    template <typename... Args>
+    std::pair<typename Table::iterator, bool> emplace(Key const &key, Args &&...args)
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] Value &at(Key const &key)
+    {
+        auto iter = this->find(key);
+
+        if (iter == this->end())
+        {
+            throw std::out_of_range("FlatHashMap::at");
+        }
+
+        return iter->second;
+    }
+
+    [[nodiscard]] Value const &at(Key const &key) const
+    {
+        auto iter = this->find(key);
+
+        if (iter == this->end())
+        {
+            throw std::out_of_range("FlatHashMap::at");
+        }
+
+        return iter->second;
+    }
+};
@@ -0,0 +1,407 @@
+#pragma once
+#include "point2d.hpp"
+#include "string.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The points of a rectangle, row by row
+class PointRange : public std::ranges::view_interface<PointRange>
+{
+    Point2d min_;
+    Point2d max_;
+
+public:
+    class Iterator
+    {
+        Point2d p_;
+        int minX_ = 0;
+        int maxX_ = -1;
+
+    public:
+        using value_type = Point2d;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        Iterator(Point2d p, int minX, int maxX)
+            : p_{p}
+            , minX_{minX}
+            , maxX_{maxX}
+        {
+        }
+
+        [[nodiscard]] Point2d operator*() const
+        {
+            return p_;
+        }
+
+        Iterator &operator++()
+        {
+            if (p_.x == maxX_)
+            {
+                p_ = {minX_, p_.y + 1};
+            }
+            else
+            {
+                ++p_.x;
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] friend bool operator==(Iterator const &a, Iterator const &b)
+        {
+            return a.p_ == b.p_;
+        }
+    };
+
+    PointRange() = default;
+
+    // inclusive bounds, empty when max is left of or above min
+    PointRange(Point2d min, Point2d max)
+        : min_{min}
+        , max_{max}
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        if (max_.x < min_.x || max_.y < min_.y)
+        {
+            return end();
+        }
+
+        return {min_, min_.x, max_.x};
+    }
+
+    [[nodiscard]] Iterator end() const
+    {
+        return {{min_.x, std::max(max_.y, min_.y - 1) + 1}, min_.x, max_.x};
+    }
+};
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<PointRange> = true;
+
+// Cells of a rectangle stored row by row, indexed by Point2d: a replacement for the
+// std::unordered_map<Point2d, T> grids that only costs an index computation per lookup.
+//
+// - Get() returns the outside value for the points out of the bounds.
+// - The border keeps that many rows and columns of outside values around the bounds:
+//   the neighbors of any cell can then be read with operator[] without checking.
+// - Grow() extends the bounds to a point, for the days exploring an unknown area. The
+//   storage grows geometrically, the bounds stay the smallest rectangle holding every
+//   point grown to, and the new cells hold the fill value.
+//
+// bool is not allowed, std::vector<bool> cannot hand out references: use char.
+template <typename T>
+class Grid2d
+{
+    static_assert(not std::same_as<T, bool>, "use char or std::uint8_t cells");
+
+    std::vector<T> cells_;
+    T fill_{};
+    T outside_{};
+    int border_ = 0;
+
+    // bounds, inclusive; empty when max_.x < min_.x
+    Point2d min_{0, 0};
+    Point2d max_{-1, -1};
+
+    // storage, at least the bounds and their border
+    Point2d origin_;
+    int stride_ = 0;
+    int rows_ = 0;
+
+    [[nodiscard]] std::size_t Index(Point2d p) const
+    {
+        return static_cast<std::size_t>((p.y - origin_.y) * stride_ + (p.x - origin_.x));
+    }
+
+    [[nodiscard]] bool IsStored(Point2d p) const
+    {
+        return p.x >= origin_.x && p.y >= origin_.y && p.x < origin_.x + stride_ && p.y < origin_.y + rows_;
+    }
+
+    void FillRow(int y, int fromX, int toX)
+    {
+        if (fromX <= toX)
+        {
+            auto const first = begin(cells_) + static_cast<std::ptrdiff_t>(Index({fromX, y}));
+            std::fill(first, first + (toX - fromX + 1), fill_);
+        }
+    }
+
+    // moves the cells to a storage holding min to max and their border
+    void Reserve(Point2d min, Point2d max)
+    {
+        min -= Point2d{border_, border_};
+        max += Point2d{border_, border_};
+
+        if (IsStored(min) && IsStored(max))
+        {
+            return;
+        }
+
+        int const width = stride_;
+        int const height = rows_;
+        Point2d origin = min;
+        Point2d limit = max + Point2d{1, 1};
+
+        // at least twice as large on the sides that grow, so that a walk pays for few moves
+        if (not cells_.empty())
+        {
+            origin.x = min.x < origin_.x ? std::min(min.x, origin_.x - width) : origin_.x;
+            origin.y = min.y < origin_.y ? std::min(min.y, origin_.y - height) : origin_.y;
+            limit.x = max.x >= origin_.x + width ? std::max(max.x + 1, origin_.x + 2 * width) : origin_.x + width;
+            limit.y = max.y >= origin_.y + height ? std::max(max.y + 1, origin_.y + 2 * height) : origin_.y + height;
+        }
+
+        Grid2d moved;
+        moved.origin_ = origin;
+        moved.stride_ = limit.x - origin.x;
+        moved.rows_ = limit.y - origin.y;
+        moved.cells_.assign(static_cast<std::size_t>(moved.stride_) * static_cast<std::size_t>(moved.rows_), outside_);
+
+        for (int y = origin_.y; y != origin_.y + height; ++y)
+        {
+            auto const first = begin(cells_) + static_cast<std::ptrdiff_t>(Index({origin_.x, y}));
+            std::move(first, first + width, begin(moved.cells_) + static_cast<std::ptrdiff_t>(moved.Index({origin_.x, y})));
+        }
+
+        cells_ = std::move(moved.cells_);
+        origin_ = origin;
+        stride_ = moved.stride_;
+        rows_ = moved.rows_;
+    }
+
+public:
+    Grid2d() = default;
+
+    // Bounds from {0, 0} to {width - 1, height - 1}, every cell holding fill
+    Grid2d(int width, int height, T fill = T{}, T outside = T{}, int border = 0)
+        : fill_{std::move(fill)}
+        , outside_{std::move(outside)}
+        , border_{border}
+    {
+        if (width > 0 && height > 0)
+        {
+            Grow({0, 0});
+            Grow({width - 1, height - 1});
+        }
+    }
+
+    // Bounds from min to max, inclusive
+    Grid2d(Point2d min, Point2d max, T fill = T{}, T outside = T{}, int border = 0)
+        : fill_{std::move(fill)}
+        , outside_{std::move(outside)}
+        , border_{border}
+    {
+        if (min.x <= max.x && min.y <= max.y)
+        {
+            Grow(min);
+            Grow(max);
+        }
+    }
+
+    // No bounds yet, they follow Grow()
+    [[nodiscard]] static Grid2d Unbounded(T fill, T outside = T{}, int border = 0)
+    {
+        return Grid2d{0, 0, std::move(fill), std::move(outside), border};
+    }
+
+    [[nodiscard]] int Width() const
+    {
+        return max_.x - min_.x + 1;
+    }
+
+    [[nodiscard]] int Height() const
+    {
+        return max_.y - min_.y + 1;
+    }
+
+    [[nodiscard]] Point2d Min() const
+    {
+        return min_;
+    }
+
+    [[nodiscard]] Point2d Max() const
+    {
+        return max_;
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return max_.x < min_.x;
+    }
+
+    [[nodiscard]] bool Contains(Point2d p) const
+    {
+        return p.x >= min_.x && p.y >= min_.y && p.x <= max_.x && p.y <= max_.y;
+    }
+
+    // Unchecked: p must be in the bounds or their border
+    [[nodiscard]] T &operator[](Point2d p)
+    {
+        return cells_[Index(p)];
+    }
+
+    [[nodiscard]] T const &operator[](Point2d p) const
+    {
+        return cells_[Index(p)];
+    }
+
+    // The outside value for the points out of the bounds
+    [[nodiscard]] T const &Get(Point2d p) const
+    {
+        return Contains(p) ? cells_[Index(p)] : outside_;
+    }
+
+    [[nodiscard]] T const &Outside() const
+    {
+        return outside_;
+    }
+
+    // Extends the bounds to p if needed and returns its cell
+    T &Grow(Point2d p)
+    {
+        if (Contains(p))
+        {
+            return cells_[Index(p)];
+        }
+
+        if (Empty())
+        {
+            Reserve(p, p);
+            min_ = max_ = p;
+            cells_[Index(p)] = fill_;
+            return cells_[Index(p)];
+        }
+
+        Point2d const min{std::min(min_.x, p.x), std::min(min_.y, p.y)};
+        Point2d const max{std::max(max_.x, p.x), std::max(max_.y, p.y)};
+        Reserve(min, max);
+
+        // the cells entering the bounds held the outside value
+        for (int y = min.y; y <= max.y; ++y)
+        {
+            if (y < min_.y || y > max_.y)
+            {
+                FillRow(y, min.x, max.x);
+            }
+            else
+            {
+                FillRow(y, min.x, min_.x - 1);
+                FillRow(y, max_.x + 1, max.x);
+            }
+        }
+
+        min_ = min;
+        max_ = max;
+        return cells_[Index(p)];
+    }
+
+    // every point of the bounds, row by row
+    [[nodiscard]] PointRange Points() const
+    {
+        return {min_, max_};
+    }
+
+    // Sets every cell of the bounds
+    void Fill(T const &value)
+    {
+        for (int y = min_.y; y <= max_.y; ++y)
+        {
+            auto const first = begin(cells_) + static_cast<std::ptrdiff_t>(Index({min_.x, y}));
+            std::fill(first, first + Width(), value);
+        }
+    }
+
+    [[nodiscard]] std::size_t Count(T const &value) const
+    {
+        std::size_t count = 0;
+
+        for (int y = min_.y; y <= max_.y; ++y)
+        {
+            auto const first = begin(cells_) + static_cast<std::ptrdiff_t>(Index({min_.x, y}));
+            count += static_cast<std::size_t>(std::count(first, first + Width(), value));
+        }
+
+        return count;
+    }
+};
+
+// One cell per character of the lines of text, from {0, 0}: transform takes the char, or
+// its position and the char. Shorter lines are completed with default cells.
+//
+//     auto const heights = ParseGrid(text, [](char c) { return c - '0'; }, 9, 1);
+template <typename TransformT>
+using ParsedCell = std::remove_cvref_t<typename std::conditional_t<std::invocable<TransformT &, Point2d, char>,
+    std::invoke_result<TransformT &, Point2d, char>, std::invoke_result<TransformT &, char>>::type>;
+
+template <typename TransformT, typename Cell = ParsedCell<TransformT>>
+[[nodiscard]] Grid2d<Cell> ParseGrid(
+    std::string_view text, TransformT &&transform, std::type_identity_t<Cell> outside = {}, int border = 0)
+{
+    int width = 0;
+    int height = 0;
+    int y = 0;
+
+    // a final newline does not add a row
+    for (auto line : Lines(text))
+    {
+        ++y;
+
+        if (not line.empty())
+        {
+            width = std::max(width, static_cast<int>(line.size()));
+            height = y;
+        }
+    }
+
+    Grid2d<Cell> grid{width, height, Cell{}, std::move(outside), border};
+    y = 0;
+
+    for (auto line : Lines(text))
+    {
+        if (y == height)
+        {
+            break;
+        }
+
+        int x = 0;
+
+        for (char c : line)
+        {
+            Point2d const p{x++, y};
+
+            if constexpr (std::invocable<TransformT &, Point2d, char>)
+            {
+                grid[p] = transform(p, c);
+            }
+            else
+            {
+                grid[p] = transform(c);
+            }
+        }
+
+        ++y;
+    }
+
+    return grid;
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include "grid2d.hpp"
+#include "point2d.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+
+// Read-only grid over the lines of a text, such as GetInput(), without copying it: row y
+// starts at y * stride, the stride being the width plus the line ending ("\n" or "\r\n").
+// Every line must be as long as the first one; the final line ending is optional.
+class GridView
+{
+    std::string_view text_;
+    int width_ = 0;
+    int height_ = 0;
+    int stride_ = 0;
+    char outside_ = '\0';
+
+    template <std::size_t N>
+    [[nodiscard]] auto NeighborsAmong(Point2d p, std::array<Point2d, N> const &dirs) const
+    {
+        auto const move = [p](Point2d dir)
+        {
+            return p + dir;
+        };
+
+        auto const isInside = [view = *this](Point2d n)
+        {
+            return view.Contains(n);
+        };
+
+        return dirs | std::views::transform(move) | std::views::filter(isInside);
+    }
+
+public:
+    static constexpr std::array<Point2d, 4> directions{Point2d::NORTH, Point2d::EAST, Point2d::SOUTH, Point2d::WEST};
+    static constexpr std::array<Point2d, 8> directionsWithDiagonals{Point2d::NORTH, Point2d::NORTH_EAST, Point2d::EAST,
+        Point2d::SOUTH_EAST, Point2d::SOUTH, Point2d::SOUTH_WEST, Point2d::WEST, Point2d::NORTH_WEST};
+
+    constexpr GridView() = default;
+
+    // outside is what Get() returns beyond the bounds
+    constexpr explicit GridView(std::string_view text, char outside = '\0')
+        : outside_{outside}
+    {
+        while (text.ends_with('\n') || text.ends_with('\r'))
+        {
+            text.remove_suffix(1);
+        }
+
+        if (text.empty())
+        {
+            return;
+        }
+
+        auto const eol = text.find('\n');
+        auto const width = eol == text.npos ? text.size() : eol - (eol != 0 && text[eol - 1] == '\r' ? 1 : 0);
+        auto const stride = eol == text.npos ? width + 1 : eol + 1;
+        auto const height = (text.size() + stride - width) / stride;
+
+        if ((height - 1) * stride + width != text.size())
+        {
+            throw std::invalid_argument("the lines of a grid must have the same length");
+        }
+
+        text_ = text;
+        width_ = static_cast<int>(width);
+        height_ = static_cast<int>(height);
+        stride_ = static_cast<int>(stride);
+    }
+
+    [[nodiscard]] constexpr int Width() const
+    {
+        return width_;
+    }
+
+    [[nodiscard]] constexpr int Height() const
+    {
+        return height_;
+    }
+
+    [[nodiscard]] constexpr bool Contains(Point2d p) const
+    {
+        return p.x >= 0 && p.y >= 0 && p.x < width_ && p.y < height_;
+    }
+
+    // Unchecked: p must be in the bounds
+    [[nodiscard]] constexpr char operator[](Point2d p) const
+    {
+        return text_[static_cast<std::size_t>(p.y * stride_ + p.x)];
+    }
+
+    // The outside char for the points out of the bounds
+    [[nodiscard]] constexpr char Get(Point2d p) const
+    {
+        return Contains(p) ? (*this)[p] : outside_;
+    }
+
+    [[nodiscard]] constexpr std::string_view Row(int y) const
+    {
+        return text_.substr(static_cast<std::size_t>(y * stride_), static_cast<std::size_t>(width_));
+    }
+
+    // the chars of column x, from top to bottom
+    [[nodiscard]] auto Column(int x) const
+    {
+        auto const at = [view = *this, x](int y)
+        {
+            return view[{x, y}];
+        };
+
+        return std::views::iota(0, height_) | std::views::transform(at);
+    }
+
+    [[nodiscard]] PointRange Points() const
+    {
+        return {{0, 0}, {width_ - 1, height_ - 1}};
+    }
+
+    // the points around p that are in the bounds, without or with the diagonals
+    [[nodiscard]] auto Neighbors(Point2d p) const
+    {
+        return NeighborsAmong(p, directions);
+    }
+
+    [[nodiscard]] auto NeighborsWithDiagonals(Point2d p) const
+    {
+        return NeighborsAmong(p, directionsWithDiagonals);
+    }
+
+    // position of the first occurrence of c, row by row
+    [[nodiscard]] constexpr std::optional<Point2d> Find(char c) const
+    {
+        auto const pos = text_.find(c);
+
+        if (pos == text_.npos)
+        {
+            return std::nullopt;
+        }
+
+        auto const offset = static_cast<int>(pos);
+        return Point2d{offset % stride_, offset / stride_};
+    }
+};
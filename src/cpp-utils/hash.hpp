@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+
+// Finalizer of splitmix64: every bit of the key affects every bit of the result, so
+// packed coordinates or small integers spread over all the buckets or control bytes
+[[nodiscard]] constexpr std::uint64_t MixBits(std::uint64_t key) noexcept
+{
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111eb;
+    key ^= key >> 31;
+    return key;
+}
+
+// the low bits of a coordinate, for packing several of them in one key
+template <int bits>
+[[nodiscard]] constexpr std::uint64_t PackCoordinate(int value) noexcept
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(value)) & ((std::uint64_t{1} << bits) - 1);
+}
@@ -0,0 +1,114 @@
+#include "input-file.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <format>
+#include <string>
+#include <system_error>
+
+#if defined(_WIN32)
+#include <Windows.h>
+
+MappedFile::MappedFile(std::filesystem::path const &path)
+{
+    HANDLE const file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    // NOLINTNEXTLINE: cppcoreguidelines-pro-type-cstyle-cast
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), path.string());
+    }
+
+    LARGE_INTEGER size{};
+    GetFileSizeEx(file, &size);
+    size_ = static_cast<std::size_t>(size.QuadPart);
+
+    if (size_ != 0)
+    {
+        HANDLE const mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping != nullptr)
+        {
+            data_ = static_cast<char const *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // the view keeps the mapping alive
+            CloseHandle(mapping);
+        }
+    }
+
+    auto const error = GetLastError();
+    CloseHandle(file);
+
+    if (size_ != 0 && data_ == nullptr)
+    {
+        throw std::system_error(static_cast<int>(error), std::system_category(), path.string());
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(std::filesystem::path const &path)
+{
+    // NOLINTNEXTLINE: cppcoreguidelines-pro-type-vararg
+    int const fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        throw std::system_error(errno, std::generic_category(), path.string());
+    }
+
+    struct stat info{};
+    void *data = MAP_FAILED;
+
+    if (fstat(fd, &info) == 0)
+    {
+        size_ = static_cast<std::size_t>(info.st_size);
+        data = size_ == 0 ? nullptr : mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+
+    auto const error = errno;
+    close(fd);
+
+    // NOLINTNEXTLINE: cppcoreguidelines-pro-type-cstyle-cast
+    if (data == MAP_FAILED)
+    {
+        throw std::system_error(error, std::generic_category(), path.string());
+    }
+
+    data_ = static_cast<char const *>(data);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-type-const-cast
+        munmap(const_cast<char *>(data_), size_);
+    }
+}
+
+#endif
+
+std::filesystem::path GetInputPath(int year, int day, std::filesystem::path const &buildTimePath)
+{
+    // NOLINTNEXTLINE: concurrency-mt-unsafe
+    if (char const *dir = std::getenv("AOC_INPUTS"); dir != nullptr && *dir != '\0')
+    {
+        return std::filesystem::path{dir} / std::to_string(year) / std::format("day{}.txt", day);
+    }
+
+    return buildTimePath;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+// Read-only memory mapping of a whole file, used when the inputs are not
+// embedded in the executables (AOC_RUNTIME_INPUTS)
+class MappedFile
+{
+    char const *data_ = nullptr;
+    std::size_t size_ = 0;
+
+public:
+    explicit MappedFile(std::filesystem::path const &path);
+    ~MappedFile();
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    [[nodiscard]] std::string_view Text() const
+    {
+        return {data_, size_};
+    }
+};
+
+// <dir>/<year>/day<day>.txt when the AOC_INPUTS environment variable names a
+// directory, the input file known at build time otherwise
+[[nodiscard]] std::filesystem::path GetInputPath(int year, int day, std::filesystem::path const &buildTimePath);
@@ -1,17 +1,17 @@
 #pragma once
 #include "string.hpp"
 
+#include <memory_resource>
 #include <vector>
 
 template <typename IntT = int, char separator = '\n'>
 inline std::vector<IntT> ParseInputNumbers()
 {
-    std::vector<IntT> numbers;
-
-    for (auto number : Split(GetInput(), separator))
-    {
-        numbers.push_back(svtoi<IntT>(number));
-    }
+    return ParseIntegers<IntT>(GetInput(), separator);
+}
 
-    return numbers;
+template <typename IntT = int, char separator = '\n'>
+inline std::pmr::vector<IntT> ParseInputNumbers(std::pmr::memory_resource *resource)
+{
+    return ParseIntegers<IntT>(GetInput(), separator, resource);
 }
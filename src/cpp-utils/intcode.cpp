@@ -1,20 +1,16 @@
 #include "intcode.hpp"
 
-#include <sstream>
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
 
-struct Intcode::Param
+Intcode::Intcode(std::vector<Int> const &code)
+    : Intcode{Memory{code}}
 {
-    Int value;
-    Intcode *cpu;
-    Mode mode;
-    Param &operator=(Int value);
-    operator Int() const;
-};
+}
 
-Intcode::Intcode(std::vector<Int> code)
-    : state{std::move(code)}
+Intcode::Intcode(Memory image)
+    : state{std::move(image)}
 {
     if (state.memory.empty())
     {
@@ -22,230 +18,162 @@ Intcode::Intcode(std::vector<Int> code)
     }
 }
 
-Intcode::Param Intcode::GetParam(Mode mode)
-{
-    return {state.memory[state.ip++], this, mode};
-}
-
-Intcode::Param &Intcode::Param::operator=(Int value_)
+Intcode::Instruction const &Intcode::Decode(std::size_t ip)
 {
-    if (mode == Mode::Immediate)
+    if (ip >= kLowCode)
     {
-        throw std::domain_error("Cannot set immediate value");
-    }
-
-    Int offset = value;
-
-    if (mode == Mode::Relative)
-    {
-        offset += cpu->state.relOffset;
-    }
-
-    if (offset >= static_cast<Int>(cpu->state.memory.size()))
-    {
-        cpu->state.memory.resize(static_cast<size_t>(offset) + 1);
+        if (auto const iter = highDecoded_.find(ip); iter != highDecoded_.end())
+        {
+            return iter->second;
+        }
     }
 
-    cpu->state.memory[static_cast<size_t>(offset)] = value_;
-    return *this;
-}
-
-Intcode::Param::operator Int() const
-{
-    if (mode == Mode::Immediate)
+    if (ip >= state.memory.size())
     {
-        return value;
+        throw std::out_of_range("Invalid instruction pointer");
     }
 
-    Int offset = value;
-
-    if (mode == Mode::Relative)
-    {
-        offset += cpu->state.relOffset;
-    }
+    Int const instruction = state.memory.Read(ip);
+    Instruction decoded;
+    std::size_t length = 0;
+    bool writes = false;
 
-    if (offset >= static_cast<Int>(cpu->state.memory.size()))
-    {
-        return 0;
-    }
-
-    return cpu->state.memory[static_cast<size_t>(offset)];
-}
-
-std::pair<typename Intcode::OpCode, Int> Intcode::GetInstruction()
-{
-    Int instruction = state.memory[state.ip++];
-    return {static_cast<OpCode>(instruction % 100), instruction / 100};
-}
-
-void Intcode::Run(std::vector<Int> code)
-{
-    Intcode a{std::move(code)};
-    a.Run();
-}
-
-void Intcode::Run(std::vector<Int> code, InputFunc &&inputFunc, OutputFunc &&outputFunc)
-{
-    Intcode a{std::move(code)};
-    a.SetInput(std::move(inputFunc));
-    a.SetOutput(std::move(outputFunc));
-    a.Run();
-}
-
-void Intcode::RunStep(Intcode::OpCode opcode, Int mode)
-{
-    switch (opcode)
+    switch (static_cast<OpCode>(instruction % 100))
     {
         case OpCode::Add:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-            auto c = GetParam(static_cast<Mode>((mode / 100) % 10));
-            c = a + b;
+            decoded.op = Op::Add;
+            length = 4;
+            writes = true;
             break;
-        }
         case OpCode::Muliply:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-            auto c = GetParam(static_cast<Mode>((mode / 100) % 10));
-            c = a * b;
+            decoded.op = Op::Multiply;
+            length = 4;
+            writes = true;
             break;
-        }
         case OpCode::Input:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            a = inputFunc_();
+            decoded.op = Op::Input;
+            length = 2;
+            writes = true;
             break;
-        }
         case OpCode::Output:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            outputFunc_(a);
+            decoded.op = Op::Output;
+            length = 2;
             break;
-        }
         case OpCode::JumpTrue:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-
-            if (a != 0)
-            {
-                state.ip = static_cast<size_t>(b);
-            }
-
+            decoded.op = Op::JumpTrue;
+            length = 3;
             break;
-        }
         case OpCode::JumpFalse:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-
-            if (a == 0)
-            {
-                state.ip = static_cast<size_t>(b);
-            }
-
+            decoded.op = Op::JumpFalse;
+            length = 3;
             break;
-        }
         case OpCode::IsLess:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-            auto c = GetParam(static_cast<Mode>((mode / 100) % 10));
-            c = a < b ? 1 : 0;
+            decoded.op = Op::IsLess;
+            length = 4;
+            writes = true;
             break;
-        }
         case OpCode::IsEqual:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            auto b = GetParam(static_cast<Mode>((mode / 10) % 10));
-            auto c = GetParam(static_cast<Mode>((mode / 100) % 10));
-            c = a == b ? 1 : 0;
+            decoded.op = Op::IsEqual;
+            length = 4;
+            writes = true;
             break;
-        }
         case OpCode::SetRelBaseOffset:
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            state.relOffset += a;
+            decoded.op = Op::SetRelBaseOffset;
+            length = 2;
             break;
-        }
         case OpCode::Halt:
-            state.halted = true;
+            decoded.op = Op::Halt;
+            length = 1;
             break;
         default:
             throw std::domain_error("Invalid opcode");
     }
-}
 
-void Intcode::Run()
-{
-    while (!state.halted)
-    {
-        auto [opcode, mode] = GetInstruction();
-        RunStep(opcode, mode);
-    }
-}
+    Int modes = instruction / 100;
 
-Intcode::OutputFunc Intcode::RunUntilInput()
-{
-    while (!state.halted)
+    for (std::size_t i = 0; i + 1 < length; ++i, modes /= 10)
     {
-        auto [opcode, mode] = GetInstruction();
+        Int const digit = modes % 10;
 
-        if (opcode == OpCode::Input)
+        if (digit < 0 || digit > 2)
         {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            return [a](Int value) mutable
-            {
-                a = value;
-            };
+            throw std::domain_error("Invalid mode");
         }
 
-        RunStep(opcode, mode);
+        decoded.modes[i] = static_cast<Mode>(digit);
     }
 
-    return nullptr;
-}
+    // the written operand is always the last one
+    if (writes && decoded.modes[length - 2] == Mode::Immediate)
+    {
+        throw std::domain_error("Cannot set immediate value");
+    }
 
-std::optional<Int> Intcode::RunUntilOuput(InputFunc &&inputFunc)
-{
-    inputFunc_ = std::move(inputFunc);
+    for (std::size_t i = 0; i + 1 < length; ++i)
+    {
+        decoded.operands[i] = state.memory.Read(ip + 1 + i);
+    }
+
+    if (ip >= kLowCode)
+    {
+        return highDecoded_[ip] = decoded;
+    }
 
-    while (!state.halted)
+    if (code_.size() < ip + length)
     {
-        auto [opcode, mode] = GetInstruction();
+        code_.resize(ip + length);
+    }
 
-        if (opcode == OpCode::Output)
-        {
-            auto a = GetParam(static_cast<Mode>(mode % 10));
-            return a;
-        }
+    std::fill_n(code_.begin() + static_cast<std::ptrdiff_t>(ip), length, std::uint8_t{1});
 
-        RunStep(opcode, mode);
+    if (decoded_.size() <= ip)
+    {
+        decoded_.resize(ip + 1);
     }
 
-    return std::nullopt;
+    return decoded_[ip] = decoded;
 }
 
-Int Intcode::ReadMemory(std::size_t offset) const
+// self-modifying code: the instructions spanning an address of [first, last) are decoded
+// again, an instruction being up to 4 values long
+void Intcode::Invalidate(std::size_t first, std::size_t last)
 {
-    return state.memory.at(offset);
+    auto const start = first < 3 ? 0 : first - 3;
+
+    for (std::size_t i = start; i < std::min(last, decoded_.size()); ++i)
+    {
+        decoded_[i].op = Op::Undecoded;
+    }
+
+    if (not highDecoded_.empty())
+    {
+        for (std::size_t i = std::max(start, kLowCode); i < last; ++i)
+        {
+            highDecoded_.erase(i);
+        }
+    }
 }
 
-Int Intcode::WriteMemory(size_t offset, Int value)
+void Intcode::Run(std::vector<Int> const &code)
 {
-    return std::exchange(state.memory[offset], value);
+    Intcode a{code};
+    a.Run();
 }
 
-void Intcode::SetInput(InputFunc &&inputFunc)
+Int Intcode::ReadMemory(std::size_t offset) const
 {
-    inputFunc_ = std::move(inputFunc);
+    if (offset >= state.memory.size())
+    {
+        throw std::out_of_range("Invalid address");
+    }
+
+    return state.memory.Read(offset);
 }
 
-void Intcode::SetOutput(OutputFunc &&outputFunc)
+Int Intcode::WriteMemory(size_t offset, Int value)
 {
-    outputFunc_ = std::move(outputFunc);
+    Invalidate(offset, offset + 1);
+    return std::exchange(state.memory.Write(offset), value);
 }
 
 Intcode::State Intcode::Backup() const
@@ -253,7 +181,15 @@ Intcode::State Intcode::Backup() const
     return state;
 }
 
+// no value is copied, the pages are shared; only the instructions in the pages that
+// differ have to be decoded again
 void Intcode::Restore(Intcode::State const &backup)
 {
+    state.memory.ForEachDifferentPage(backup.memory,
+        [&](std::size_t first, std::size_t last)
+        {
+            Invalidate(first, last);
+        });
+
     state = backup;
 }
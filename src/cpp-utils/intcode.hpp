@@ -1,27 +1,102 @@
 #pragma once
+#include "flathash.hpp"
+#include "pagedmemory.hpp"
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 using Int = long long;
 
+// Direct threading: every handler jumps to the next one through a table of label
+// addresses, a GCC and Clang extension. The other compilers use a switch.
+#if defined(__GNUC__)
+#define AOC_INTCODE_COMPUTED_GOTO 1
+#endif
+
+// the memory accesses of the handlers, that the compilers stop inlining once a few runs
+// are instantiated
+#if defined(__GNUC__)
+#define AOC_INTCODE_INLINE [[gnu::always_inline]] inline
+#elif defined(_MSC_VER)
+#define AOC_INTCODE_INLINE __forceinline
+#else
+#define AOC_INTCODE_INLINE inline
+#endif
+
+// The I/O of a program is a policy: Input(value) gives the next value read and
+// Output(value) takes a value written, both returning false when they cannot, the
+// program then stops at the instruction until it is resumed. The policy is a template
+// parameter of the runs, its calls are inlined.
+
+// I/O by two callbacks, input() returning the value read and output(value); nullptr for
+// a program that never reads or never writes
+template <typename InputT, typename OutputT>
+struct IntcodeCallbacks
+{
+    InputT input;
+    OutputT output;
+
+    bool Input(Int &value)
+    {
+        if constexpr (std::is_null_pointer_v<std::remove_cvref_t<InputT>>)
+        {
+            throw std::logic_error("Intcode: no input");
+        }
+        else
+        {
+            value = input();
+            return true;
+        }
+    }
+
+    bool Output(Int value)
+    {
+        if constexpr (std::is_null_pointer_v<std::remove_cvref_t<OutputT>>)
+        {
+            throw std::logic_error("Intcode: no output");
+        }
+        else
+        {
+            output(value);
+            return true;
+        }
+    }
+};
+
+template <typename InputT, typename OutputT>
+IntcodeCallbacks(InputT &&, OutputT &&) -> IntcodeCallbacks<InputT, OutputT>;
+
 class Intcode
 {
 public:
+    // copied in O(1), the pages being shared until written
+    using Memory = PagedMemory<Int>;
+
     struct State
     {
-        std::vector<Int> memory;
+        Memory memory;
         std::size_t ip = 0;
         Int relOffset = 0;
         bool halted = false;
     };
 
-private:
-    using InputFunc = std::function<Int()>;
-    using OutputFunc = std::function<void(Int)>;
+    // the instruction a run stopped at
+    enum class Status
+    {
+        Halted,
+        Input,
+        Output,
+    };
 
-    enum class Mode
+private:
+    enum class Mode : std::uint8_t
     {
         Address = 0,
         Immediate = 1,
@@ -43,32 +118,130 @@ private:
         Halt = 99,
     };
 
-    struct Param;
+    // An instruction decoded once, by its address: the opcode becomes the index of its
+    // handler, the modes are split and the operands copied. Writing to any of its
+    // addresses makes it undecoded again.
+    struct Instruction
+    {
+        enum class Op : std::uint8_t
+        {
+            Undecoded,
+            Add,
+            Multiply,
+            Input,
+            Output,
+            JumpTrue,
+            JumpFalse,
+            IsLess,
+            IsEqual,
+            SetRelBaseOffset,
+            Halt,
+        };
+
+        Op op = Op::Undecoded;
+        std::array<Mode, 3> modes{};
+        std::array<Int, 3> operands{};
+    };
+
+    using Op = Instruction::Op;
 
     State state;
-    InputFunc inputFunc_;
-    OutputFunc outputFunc_;
 
-    Param GetParam(Mode mode);
-    std::pair<OpCode, Int> GetInstruction();
+    // the code below is decoded in flat tables, the code above, that a program would
+    // only write far away, in a hash map: their size follows the code and not its address
+    static constexpr std::size_t kLowCode = std::size_t{1} << 20;
+
+    // by address, up to the last instruction decoded below kLowCode
+    std::vector<Instruction> decoded_;
+
+    // by address, 1 when read by Decode(): only the stores there undecode instructions
+    std::vector<std::uint8_t> code_;
 
-    void RunStep(OpCode opcode, Int mode);
+    // by address, the instructions decoded from kLowCode
+    FlatHashMap<std::size_t, Instruction> highDecoded_;
+
+    Instruction const &Fetch(std::size_t ip);
+    Instruction const &Decode(std::size_t ip);
+    void Invalidate(std::size_t first, std::size_t last);
+    [[nodiscard]] Int Load(Mode mode, Int operand) const;
+    void Store(Mode mode, Int operand, Int value);
+
+    template <typename IoT>
+    Op Execute(IoT &io, Op stopAt);
 
 public:
-    explicit Intcode(std::vector<Int> code);
-    void Run();
-    OutputFunc RunUntilInput();
-    [[nodiscard]] std::optional<Int> RunUntilOuput(InputFunc &&inputFunc);
+    explicit Intcode(std::vector<Int> const &code);
 
-    static void Run(std::vector<Int> code);
-    static void Run(std::vector<Int> code, InputFunc &&inputFunc, OutputFunc &&outputFunc);
+    // a new instance of a program image, sharing its pages
+    explicit Intcode(Memory image);
+
+    // Runs until the program halts or io cannot take an input or an output: the next call
+    // starts again from that instruction
+    template <typename IoT>
+    Status Resume(IoT &io)
+    {
+        switch (Execute(io, Op::Halt))
+        {
+            case Op::Input:
+                return Status::Input;
+            case Op::Output:
+                return Status::Output;
+            default:
+                return Status::Halted;
+        }
+    }
+
+    // Runs until the program halts, input() giving the values read and output(value)
+    // taking the values written
+    template <typename InputT, typename OutputT>
+    void Run(InputT &&input, OutputT &&output)
+    {
+        IntcodeCallbacks<InputT &, OutputT &> io{input, output};
+        Execute(io, Op::Halt);
+    }
+
+    void Run()
+    {
+        Run(nullptr, nullptr);
+    }
+
+    // Runs until the next output, none when the program halts first
+    template <typename InputT>
+    [[nodiscard]] std::optional<Int> RunUntilOuput(InputT &&input)
+    {
+        IntcodeCallbacks<InputT &, std::nullptr_t> io{input, nullptr};
+
+        if (Execute(io, Op::Output) != Op::Output)
+        {
+            return std::nullopt;
+        }
+
+        auto const &ins = Fetch(state.ip);
+        auto const value = Load(ins.modes[0], ins.operands[0]);
+        state.ip += 2;
+        return value;
+    }
+
+    static void Run(std::vector<Int> const &code);
+
+    template <typename InputT, typename OutputT>
+    static void Run(std::vector<Int> const &code, InputT &&input, OutputT &&output)
+    {
+        Intcode a{code};
+        a.Run(input, output);
+    }
+
+    // runs a new instance of image, its pages only copied when written
+    template <typename InputT, typename OutputT>
+    static void Run(Memory const &image, InputT &&input, OutputT &&output)
+    {
+        Intcode a{image};
+        a.Run(input, output);
+    }
 
     [[nodiscard]] Int ReadMemory(std::size_t offset) const;
     Int WriteMemory(std::size_t offset, Int value);
 
-    void SetInput(InputFunc &&inputFunc);
-    void SetOutput(OutputFunc &&outputFunc);
-
     [[nodiscard]] bool IsHalted() const
     {
         return state.halted;
@@ -77,3 +250,191 @@ public:
     [[nodiscard]] State Backup() const;
     void Restore(State const &backup);
 };
+
+AOC_INTCODE_INLINE Intcode::Instruction const &Intcode::Fetch(std::size_t ip)
+{
+    if (ip < decoded_.size() && decoded_[ip].op != Op::Undecoded) [[likely]]
+    {
+        return decoded_[ip];
+    }
+
+    return Decode(ip);
+}
+
+AOC_INTCODE_INLINE Int Intcode::Load(Mode mode, Int operand) const
+{
+    if (mode == Mode::Immediate)
+    {
+        return operand;
+    }
+
+    return state.memory.Read(static_cast<std::size_t>(mode == Mode::Relative ? operand + state.relOffset : operand));
+}
+
+AOC_INTCODE_INLINE void Intcode::Store(Mode mode, Int operand, Int value)
+{
+    auto const address = static_cast<std::size_t>(mode == Mode::Relative ? operand + state.relOffset : operand);
+    state.memory.Write(address) = value;
+
+    if ((address < code_.size() && code_[address] != 0) || (address >= kLowCode && not highDecoded_.empty())) [[unlikely]]
+    {
+        Invalidate(address, address + 1);
+    }
+}
+
+#if defined(AOC_INTCODE_COMPUTED_GOTO)
+// label addresses and computed gotos are extensions
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define AOC_INTCODE_HANDLER(name) handle##name
+#define AOC_INTCODE_NEXT() goto *kHandlers[static_cast<std::size_t>((ins = &Fetch(ip))->op)]
+#else
+#define AOC_INTCODE_HANDLER(name) case Op::name
+#define AOC_INTCODE_NEXT() continue
+#endif
+
+// Runs until the program halts, reaches an instruction stopAt or io cannot take an input
+// or an output; that instruction is left for the next call. Returns the one it stopped
+// at. Every instruction is decoded once until it is overwritten.
+template <typename IoT>
+Intcode::Op Intcode::Execute(IoT &io, Op stopAt)
+{
+    if (state.halted)
+    {
+        return Op::Halt;
+    }
+
+    // ip stays in a register, state.ip is only updated when leaving
+    std::size_t ip = state.ip;
+    Instruction const *ins = nullptr;
+
+#if defined(AOC_INTCODE_COMPUTED_GOTO)
+    static void *const kHandlers[] = {
+        &&handleUndecoded,
+        &&handleAdd,
+        &&handleMultiply,
+        &&handleInput,
+        &&handleOutput,
+        &&handleJumpTrue,
+        &&handleJumpFalse,
+        &&handleIsLess,
+        &&handleIsEqual,
+        &&handleSetRelBaseOffset,
+        &&handleHalt,
+    };
+
+    AOC_INTCODE_NEXT();
+#else
+    for (;;)
+    {
+        ins = &Fetch(ip);
+
+        switch (ins->op)
+        {
+#endif
+    AOC_INTCODE_HANDLER(Add):
+    {
+        auto const &operands = ins->operands;
+        Store(ins->modes[2], operands[2], Load(ins->modes[0], operands[0]) + Load(ins->modes[1], operands[1]));
+        ip += 4;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(Multiply):
+    {
+        auto const &operands = ins->operands;
+        Store(ins->modes[2], operands[2], Load(ins->modes[0], operands[0]) * Load(ins->modes[1], operands[1]));
+        ip += 4;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(Input):
+    {
+        state.ip = ip;
+
+        if (stopAt == Op::Input)
+        {
+            return Op::Input;
+        }
+
+        Int value = 0;
+
+        if (not io.Input(value))
+        {
+            return Op::Input;
+        }
+
+        Store(ins->modes[0], ins->operands[0], value);
+        ip += 2;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(Output):
+    {
+        state.ip = ip;
+
+        if (stopAt == Op::Output)
+        {
+            return Op::Output;
+        }
+
+        if (not io.Output(Load(ins->modes[0], ins->operands[0])))
+        {
+            return Op::Output;
+        }
+
+        ip += 2;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(JumpTrue):
+    {
+        auto const &operands = ins->operands;
+        ip = Load(ins->modes[0], operands[0]) != 0 ? static_cast<std::size_t>(Load(ins->modes[1], operands[1])) : ip + 3;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(JumpFalse):
+    {
+        auto const &operands = ins->operands;
+        ip = Load(ins->modes[0], operands[0]) == 0 ? static_cast<std::size_t>(Load(ins->modes[1], operands[1])) : ip + 3;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(IsLess):
+    {
+        auto const &operands = ins->operands;
+        Store(ins->modes[2], operands[2], Load(ins->modes[0], operands[0]) < Load(ins->modes[1], operands[1]) ? 1 : 0);
+        ip += 4;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(IsEqual):
+    {
+        auto const &operands = ins->operands;
+        Store(ins->modes[2], operands[2], Load(ins->modes[0], operands[0]) == Load(ins->modes[1], operands[1]) ? 1 : 0);
+        ip += 4;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(SetRelBaseOffset):
+    {
+        state.relOffset += Load(ins->modes[0], ins->operands[0]);
+        ip += 2;
+        AOC_INTCODE_NEXT();
+    }
+    AOC_INTCODE_HANDLER(Halt):
+    {
+        state.ip = ip + 1;
+        state.halted = true;
+        return Op::Halt;
+    }
+    AOC_INTCODE_HANDLER(Undecoded):
+    {
+        // Fetch() never returns one
+        throw std::logic_error("Undecoded instruction");
+    }
+#if not defined(AOC_INTCODE_COMPUTED_GOTO)
+        }
+    }
+#endif
+}
+
+#undef AOC_INTCODE_HANDLER
+#undef AOC_INTCODE_NEXT
+
+#if defined(AOC_INTCODE_COMPUTED_GOTO)
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,220 @@
+#include "intcodenetwork.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+IntcodeNetwork::Node::Node(Intcode machine)
+    : cpu{std::move(machine)}
+{
+}
+
+IntcodeNetwork::Node::~Node()
+{
+    if (task.handle)
+    {
+        task.handle.destroy();
+    }
+}
+
+bool IntcodeNetwork::Port::Input(Int &value)
+{
+    if (not node->input.TryPop(value))
+    {
+        return false;
+    }
+
+    network->Wake(node->producer, Intcode::Status::Output);
+    return true;
+}
+
+bool IntcodeNetwork::Port::Output(Int value)
+{
+    if (not node->target->TryPush(value))
+    {
+        return false;
+    }
+
+    network->Wake(node->consumer, Intcode::Status::Input);
+    return true;
+}
+
+// the channel is checked again under the lock: a value pushed by another thread since
+// the machine stopped either is seen here or wakes it later
+bool IntcodeNetwork::Wait::await_suspend(std::coroutine_handle<> /*handle*/)
+{
+    std::scoped_lock lock{network->mutex_};
+
+    if (CanResume(*node, status))
+    {
+        return false;
+    }
+
+    node->waiting = status;
+    return true;
+}
+
+IntcodeNetwork::Task IntcodeNetwork::Execute(Node &node)
+{
+    Port port{this, &node};
+
+    for (auto status = node.cpu.Resume(port); status != Intcode::Status::Halted; status = node.cpu.Resume(port))
+    {
+        co_await Wait{this, &node, status};
+    }
+}
+
+bool IntcodeNetwork::CanResume(Node const &node, Intcode::Status status)
+{
+    switch (status)
+    {
+        case Intcode::Status::Input:
+            return not node.input.Empty();
+        case Intcode::Status::Output:
+            return node.target->Size() != Channel<Int>::MaxSize();
+        default:
+            return false;
+    }
+}
+
+void IntcodeNetwork::Wake(Node *node, Intcode::Status status)
+{
+    if (node == nullptr)
+    {
+        return;
+    }
+
+    std::scoped_lock lock{mutex_};
+
+    if (node->waiting == status)
+    {
+        node->waiting.reset();
+        ready_.push_back(node);
+        changed_.notify_one();
+    }
+}
+
+void IntcodeNetwork::Work()
+{
+    std::unique_lock lock{mutex_};
+
+    while (true)
+    {
+        // nothing ready and nothing running: no machine can be woken any more
+        changed_.wait(lock,
+            [&]
+            {
+                return not ready_.empty() || running_ == 0 || error_;
+            });
+
+        if (ready_.empty() || error_)
+        {
+            changed_.notify_all();
+            return;
+        }
+
+        auto *node = ready_.front();
+        ready_.pop_front();
+        ++running_;
+        lock.unlock();
+
+        // the node is not looked at after, another thread may already be resuming it
+        try
+        {
+            node->task.handle.resume();
+        }
+        catch (...)
+        {
+            lock.lock();
+
+            if (not error_)
+            {
+                error_ = std::current_exception();
+            }
+
+            --running_;
+            continue;
+        }
+
+        lock.lock();
+        --running_;
+    }
+}
+
+IntcodeNetwork::Id IntcodeNetwork::Add(Intcode cpu)
+{
+    auto &node = *nodes_.emplace_back(std::make_unique<Node>(std::move(cpu)));
+    node.task = Execute(node);
+
+    // started by the next run
+    ready_.push_back(&node);
+    return nodes_.size() - 1;
+}
+
+void IntcodeNetwork::Connect(Id from, Id to)
+{
+    auto &source = *nodes_.at(from);
+    auto &sink = *nodes_.at(to);
+
+    if (source.consumer != nullptr || sink.producer != nullptr)
+    {
+        throw std::logic_error("IntcodeNetwork: already connected");
+    }
+
+    source.target = &sink.input;
+    source.consumer = &sink;
+    sink.producer = &source;
+}
+
+Channel<Int> &IntcodeNetwork::Input(Id node)
+{
+    return nodes_.at(node)->input;
+}
+
+Channel<Int> &IntcodeNetwork::Output(Id node)
+{
+    return nodes_.at(node)->output;
+}
+
+bool IntcodeNetwork::IsHalted(Id node) const
+{
+    return nodes_.at(node)->cpu.IsHalted();
+}
+
+void IntcodeNetwork::Run(std::size_t threadCount)
+{
+    {
+        std::scoped_lock lock{mutex_};
+
+        // the machines waiting for the values the caller pushed, or the room it made
+        for (auto &node : nodes_)
+        {
+            if (node->waiting.has_value() && CanResume(*node, *node->waiting))
+            {
+                node->waiting.reset();
+                ready_.push_back(node.get());
+            }
+        }
+    }
+
+    {
+        std::vector<std::jthread> threads;
+
+        for (std::size_t i = 1; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [this]
+                {
+                    Work();
+                });
+        }
+
+        // the calling thread is one of the workers
+        Work();
+    }
+
+    if (error_)
+    {
+        std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+}
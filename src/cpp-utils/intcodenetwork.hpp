@@ -0,0 +1,165 @@
+#pragma once
+#include "channel.hpp"
+#include "intcode.hpp"
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Intcode machines connected by channels, each running as a coroutine: it suspends when
+// its input is empty or its output full, and is put back in the ready queue by the
+// machine that fills or empties the channel. The queue is shared by the threads of
+// Run(), that sleep when it is empty, so nothing polls.
+//
+// A channel has one producer, so a machine reads from one machine at most: chains and
+// rings of any length, or any graph where every machine has one input and one output.
+// The inputs and outputs left unconnected are fed and drained by the caller between the
+// runs: Run() returns once no machine can go on, halted or waiting.
+//
+//     IntcodeNetwork network;
+//     auto const a = network.Add(Intcode{code});
+//     auto const b = network.Add(Intcode{code});
+//     network.Connect(a, b);
+//     network.Input(a).TryPush(1);
+//     network.Run();
+//     network.Output(b).TryPop(value);
+class IntcodeNetwork
+{
+public:
+    using Id = std::size_t;
+
+private:
+    struct Node;
+
+    // the coroutine of a machine, started and resumed by the network only
+    struct Task
+    {
+        struct promise_type
+        {
+            Task get_return_object()
+            {
+                return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            static std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            static std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void()
+            {
+            }
+
+            // thrown out of resume(), to the thread that runs the machine
+            static void unhandled_exception()
+            {
+                throw;
+            }
+        };
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    // I/O of a machine that wakes the machine on the other side of the channel
+    struct Port
+    {
+        IntcodeNetwork *network = nullptr;
+        Node *node = nullptr;
+
+        bool Input(Int &value);
+        bool Output(Int value);
+    };
+
+    // suspends the machine until it can go on, unless it already can
+    struct Wait
+    {
+        IntcodeNetwork *network = nullptr;
+        Node *node = nullptr;
+        Intcode::Status status = Intcode::Status::Halted;
+
+        [[nodiscard]] static bool await_ready() noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> /*handle*/);
+
+        static void await_resume() noexcept
+        {
+        }
+    };
+
+    struct Node
+    {
+        Intcode cpu;
+        Channel<Int> input;
+        Channel<Int> output;
+
+        // the channel written, output or the input of the next machine
+        Channel<Int> *target = &output;
+        Node *producer = nullptr;
+        Node *consumer = nullptr;
+
+        Task task;
+
+        // why it is suspended, nullopt while it is ready or running
+        std::optional<Intcode::Status> waiting;
+
+        explicit Node(Intcode machine);
+        Node(Node const &) = delete;
+        Node &operator=(Node const &) = delete;
+        ~Node();
+    };
+
+    std::vector<std::unique_ptr<Node>> nodes_;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::deque<Node *> ready_;
+    std::size_t running_ = 0;
+    std::exception_ptr error_;
+
+    Task Execute(Node &node);
+
+    [[nodiscard]] static bool CanResume(Node const &node, Intcode::Status status);
+    void Wake(Node *node, Intcode::Status status);
+    void Work();
+
+public:
+    IntcodeNetwork() = default;
+
+    // the coroutines point to the network
+    IntcodeNetwork(IntcodeNetwork const &) = delete;
+    IntcodeNetwork &operator=(IntcodeNetwork const &) = delete;
+
+    ~IntcodeNetwork() = default;
+
+    // the ids are 0, 1, 2... in the order the machines are added
+    Id Add(Intcode cpu);
+
+    // the output of from becomes the input of to; throws std::logic_error when either is
+    // already connected this way
+    void Connect(Id from, Id to);
+
+    // the values read by a machine, and the values written when its output is not
+    // connected: only used by the caller between the runs
+    [[nodiscard]] Channel<Int> &Input(Id node);
+    [[nodiscard]] Channel<Int> &Output(Id node);
+
+    [[nodiscard]] bool IsHalted(Id node) const;
+
+    // Runs the machines until none can go on, on threadCount threads including the
+    // calling one; rethrows the first exception of a machine
+    void Run(std::size_t threadCount = 1);
+};
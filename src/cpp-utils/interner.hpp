@@ -0,0 +1,61 @@
+#pragma once
+#include "flathash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Dense ids for names, such as the nodes of a graph read from the input: the first name
+// interned gets 0, the next new one 1, and so on. The ids can index flat arrays and
+// adjacency matrices instead of maps keyed by strings.
+//
+// Only views are kept: the names must outlive the interner, as GetInput() and the string
+// literals do.
+class Interner
+{
+    FlatHashMap<std::string_view, std::uint32_t> ids_;
+    std::vector<std::string_view> names_;
+
+public:
+    // the id of name, a new one when name was not interned yet
+    std::uint32_t Intern(std::string_view name)
+    {
+        auto const [iter, added] = ids_.try_emplace(name, static_cast<std::uint32_t>(names_.size()));
+
+        if (added)
+        {
+            names_.push_back(name);
+        }
+
+        return iter->second;
+    }
+
+    [[nodiscard]] std::optional<std::uint32_t> Find(std::string_view name) const
+    {
+        if (auto const iter = ids_.find(name); iter != ids_.end())
+        {
+            return iter->second;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] std::string_view Name(std::uint32_t id) const
+    {
+        return names_[id];
+    }
+
+    // number of names, the ids going from 0 to Size() - 1
+    [[nodiscard]] std::size_t Size() const
+    {
+        return names_.size();
+    }
+
+    [[nodiscard]] std::span<std::string_view const> Names() const
+    {
+        return names_;
+    }
+};
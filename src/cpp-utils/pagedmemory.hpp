@@ -0,0 +1,277 @@
+#pragma once
+#include "flathash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+// the accesses to the owned pages, that the compilers do not inline into a large caller
+// such as an interpreter loop
+#if defined(__GNUC__)
+#define AOC_PAGED_MEMORY_INLINE [[gnu::always_inline]] inline
+#elif defined(_MSC_VER)
+#define AOC_PAGED_MEMORY_INLINE __forceinline
+#else
+#define AOC_PAGED_MEMORY_INLINE inline
+#endif
+
+// Memory of values split into pages of 2^PageBits values shared between the copies until
+// one of them writes: copying the memory only shares the table of pages, O(1), and a
+// write copies the table, then the page, when they are shared. The pages never written
+// read as T{} and take no room.
+//
+// The address space is sparse: the pages of the first 2^LowBits addresses are indexed by
+// a vector, the ones above by a hash map, so that writing far away allocates one page
+// and not everything below it.
+//
+// A shared page is never written, so the copies may be used on different threads, and
+// several threads may copy the same memory at once: copying only reads the source and
+// sets its shared flag.
+template <typename T, std::size_t PageBits = 9, std::size_t LowBits = 20>
+class PagedMemory
+{
+    static_assert(PageBits <= LowBits);
+
+public:
+    static constexpr std::size_t kPageSize = std::size_t{1} << PageBits;
+    using Page = std::array<T, kPageSize>;
+
+private:
+    static constexpr std::size_t kMask = kPageSize - 1;
+    static constexpr std::size_t kLowPages = std::size_t{1} << (LowBits - PageBits);
+
+    struct Table
+    {
+        std::vector<std::shared_ptr<Page>> low;
+        FlatHashMap<std::size_t, std::shared_ptr<Page>> high;
+    };
+
+    std::shared_ptr<Table> table_;
+    std::size_t size_ = 0;
+
+    // the low pages known to be owned by this memory alone, by index, that are written
+    // without looking at the counts; read freely, but forgotten before the next write
+    // once the memory has been copied
+    std::vector<T *> owned_;
+
+    // set by the copies, atomic since they may be made on other threads
+    mutable std::atomic<bool> shared_{false};
+
+    [[nodiscard]] Page const *Find(std::size_t page) const
+    {
+        if (not table_)
+        {
+            return nullptr;
+        }
+
+        if (page < kLowPages)
+        {
+            return page < table_->low.size() ? table_->low[page].get() : nullptr;
+        }
+
+        auto const iter = table_->high.find(page);
+        return iter != table_->high.end() ? iter->second.get() : nullptr;
+    }
+
+    T ReadShared(std::size_t page, std::size_t offset) const
+    {
+        auto const *values = Find(page);
+        return values != nullptr ? (*values)[offset] : T{};
+    }
+
+    // copies the table, then the page, when they are shared
+    T *Own(std::size_t page)
+    {
+        if (shared_.exchange(false, std::memory_order_relaxed))
+        {
+            owned_.clear();
+        }
+
+        if (not table_)
+        {
+            table_ = std::make_shared<Table>();
+        }
+        else if (table_.use_count() != 1)
+        {
+            table_ = std::make_shared<Table>(*table_);
+        }
+
+        if (page < kLowPages && page >= table_->low.size())
+        {
+            table_->low.resize(page + 1);
+        }
+
+        auto &values = page < kLowPages ? table_->low[page] : table_->high[page];
+
+        if (not values)
+        {
+            values = std::make_shared<Page>();
+        }
+        else if (values.use_count() != 1)
+        {
+            values = std::make_shared<Page>(*values);
+        }
+
+        if (page >= kLowPages)
+        {
+            return values->data();
+        }
+
+        if (page >= owned_.size())
+        {
+            owned_.resize(page + 1);
+        }
+
+        return owned_[page] = values->data();
+    }
+
+public:
+    PagedMemory() = default;
+
+    PagedMemory(PagedMemory const &other)
+        : table_{other.table_}
+        , size_{other.size_}
+    {
+        other.shared_.store(true, std::memory_order_relaxed);
+    }
+
+    PagedMemory(PagedMemory &&other) noexcept
+        : table_{std::move(other.table_)}
+        , size_{std::exchange(other.size_, 0)}
+        , owned_{std::move(other.owned_)}
+        , shared_{other.shared_.load(std::memory_order_relaxed)}
+    {
+    }
+
+    PagedMemory &operator=(PagedMemory const &other)
+    {
+        if (this != &other)
+        {
+            table_ = other.table_;
+            size_ = other.size_;
+            owned_.clear();
+            shared_.store(false, std::memory_order_relaxed);
+            other.shared_.store(true, std::memory_order_relaxed);
+        }
+
+        return *this;
+    }
+
+    PagedMemory &operator=(PagedMemory &&other) noexcept
+    {
+        table_ = std::move(other.table_);
+        size_ = std::exchange(other.size_, 0);
+        owned_ = std::move(other.owned_);
+        shared_.store(other.shared_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    ~PagedMemory() = default;
+
+    explicit PagedMemory(std::span<T const> values)
+        : size_{values.size()}
+    {
+        for (std::size_t first = 0; first < values.size(); first += kPageSize)
+        {
+            auto const count = std::min(kPageSize, values.size() - first);
+            std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(first), count, Own(first >> PageBits));
+        }
+    }
+
+    // one past the highest address written
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] AOC_PAGED_MEMORY_INLINE T Read(std::size_t address) const
+    {
+        auto const page = address >> PageBits;
+
+        if (page < owned_.size() && owned_[page] != nullptr) [[likely]]
+        {
+            return owned_[page][address & kMask];
+        }
+
+        return ReadShared(page, address & kMask);
+    }
+
+    // the value at address, its page owned by this memory alone
+    AOC_PAGED_MEMORY_INLINE T &Write(std::size_t address)
+    {
+        auto const page = address >> PageBits;
+
+        if (address >= size_)
+        {
+            size_ = address + 1;
+        }
+
+        if (page < owned_.size() && owned_[page] != nullptr && not shared_.load(std::memory_order_relaxed)) [[likely]]
+        {
+            return owned_[page][address & kMask];
+        }
+
+        return Own(page)[address & kMask];
+    }
+
+    void Write(std::size_t address, T value)
+    {
+        Write(address) = std::move(value);
+    }
+
+    // Calls func(first, last) with the addresses of every page that is not shared with
+    // other, written by one of them or by both; nothing when the tables are shared
+    template <typename FuncT>
+    void ForEachDifferentPage(PagedMemory const &other, FuncT &&func) const
+    {
+        if (table_ == other.table_)
+        {
+            return;
+        }
+
+        auto const compare = [&](std::size_t page)
+        {
+            if (Find(page) != other.Find(page))
+            {
+                func(page << PageBits, (page + 1) << PageBits);
+            }
+        };
+
+        auto const lowPages = std::max(table_ ? table_->low.size() : 0, other.table_ ? other.table_->low.size() : 0);
+
+        for (std::size_t page = 0; page != lowPages; ++page)
+        {
+            compare(page);
+        }
+
+        if (table_)
+        {
+            for (auto const &[page, values] : table_->high)
+            {
+                compare(page);
+            }
+        }
+
+        if (other.table_)
+        {
+            for (auto const &[page, values] : other.table_->high)
+            {
+                // the pages of both were compared above
+                if (Find(page) == nullptr)
+                {
+                    compare(page);
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,186 @@
+#include "perf.hpp"
+
+#include <format>
+#include <string_view>
+
+using Counter = std::optional<std::uint64_t> PerfCounters::*;
+
+void PerfCounters::Divide(std::uint64_t calls)
+{
+    if (calls == 0)
+    {
+        return;
+    }
+
+    for (Counter const counter : {&PerfCounters::cycles, &PerfCounters::instructions, &PerfCounters::branchMisses,
+             &PerfCounters::l1dMisses, &PerfCounters::llcMisses})
+    {
+        if (auto &value = this->*counter; value.has_value())
+        {
+            *value /= calls;
+        }
+    }
+}
+
+// 1234567 -> "1.23M"
+static std::string FormatCount(std::uint64_t count)
+{
+    constexpr std::string_view suffixes = " kMGTP";
+    auto value = static_cast<double>(count);
+    std::size_t scale = 0;
+
+    while (value >= 1000 && scale + 1 != suffixes.size())
+    {
+        value /= 1000;
+        ++scale;
+    }
+
+    if (scale == 0)
+    {
+        return std::format("{}", count);
+    }
+
+    return std::format("{:.3g}{}", value, suffixes[scale]);
+}
+
+std::string FormatCounters(PerfCounters const &counters)
+{
+    std::string text;
+
+    auto const append = [&text](std::optional<std::uint64_t> const &value, std::string_view name)
+    {
+        if (value.has_value())
+        {
+            text += std::format("{}{} {}", text.empty() ? "" : ", ", FormatCount(*value), name);
+        }
+    };
+
+    append(counters.cycles, "cycles");
+    append(counters.instructions, "instructions");
+
+    if (counters.cycles.value_or(0) != 0 && counters.instructions.has_value())
+    {
+        text += std::format(" (IPC {:.2f})",
+            static_cast<double>(*counters.instructions) / static_cast<double>(*counters.cycles));
+    }
+
+    append(counters.branchMisses, "branch misses");
+    append(counters.l1dMisses, "L1d misses");
+    append(counters.llcMisses, "LLC misses");
+    return text.empty() ? "no hardware counters" : text;
+}
+
+#if defined(__linux__)
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+struct PerfEvent
+{
+    std::uint32_t type;
+    std::uint64_t config;
+    Counter counter;
+};
+
+static constexpr std::uint64_t CacheMiss(std::uint64_t cache)
+{
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+static constexpr std::array<PerfEvent, PerfScope::eventCount> perfEvents{{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &PerfCounters::cycles},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &PerfCounters::instructions},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, &PerfCounters::branchMisses},
+    {PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_L1D), &PerfCounters::l1dMisses},
+    {PERF_TYPE_HW_CACHE, CacheMiss(PERF_COUNT_HW_CACHE_LL), &PerfCounters::llcMisses},
+}};
+
+// the events are not grouped: a PMU with too few registers multiplexes them, which
+// the enabled and running times let us correct for
+struct PerfReading
+{
+    std::uint64_t value;
+    std::uint64_t enabled;
+    std::uint64_t running;
+};
+
+static int OpenEvent(PerfEvent const &event)
+{
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    // calling thread, any cpu, no group
+    // NOLINTNEXTLINE: cppcoreguidelines-pro-type-vararg
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+PerfScope::PerfScope(PerfCounters &counters)
+    : counters_{counters}
+{
+    for (std::size_t i = 0; i != eventCount; ++i)
+    {
+        fds_[i] = OpenEvent(perfEvents[i]);
+    }
+
+    // enabled last, so that opening the other events is not counted
+    for (int const fd : fds_)
+    {
+        if (fd != -1)
+        {
+            // NOLINTNEXTLINE: cppcoreguidelines-pro-type-vararg
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+PerfScope::~PerfScope()
+{
+    for (int const fd : fds_)
+    {
+        if (fd != -1)
+        {
+            // NOLINTNEXTLINE: cppcoreguidelines-pro-type-vararg
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (std::size_t i = 0; i != eventCount; ++i)
+    {
+        if (fds_[i] == -1)
+        {
+            continue;
+        }
+
+        PerfReading reading{};
+
+        if (read(fds_[i], &reading, sizeof(reading)) == sizeof(reading) && reading.running != 0)
+        {
+            auto const scaled = static_cast<double>(reading.value) * static_cast<double>(reading.enabled) /
+                static_cast<double>(reading.running);
+            auto &counter = counters_.*perfEvents[i].counter;
+            counter = counter.value_or(0) + static_cast<std::uint64_t>(scaled);
+        }
+
+        close(fds_[i]);
+    }
+}
+
+#else
+
+PerfScope::PerfScope(PerfCounters &counters)
+    : counters_{counters}
+{
+    fds_.fill(-1);
+}
+
+PerfScope::~PerfScope() = default;
+
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+// Hardware events counted over a region, unset when the machine or the kernel does
+// not provide them (no PMU in a virtual machine, perf_event_paranoid, not Linux...)
+struct PerfCounters
+{
+    std::optional<std::uint64_t> cycles;
+    std::optional<std::uint64_t> instructions;
+    std::optional<std::uint64_t> branchMisses;
+    std::optional<std::uint64_t> l1dMisses;
+    std::optional<std::uint64_t> llcMisses;
+
+    // turns totals over several calls into per call values
+    void Divide(std::uint64_t calls);
+};
+
+[[nodiscard]] std::string FormatCounters(PerfCounters const &counters);
+
+// Counts the events of the calling thread, user space only, from construction to
+// destruction and adds them to the counters
+class PerfScope
+{
+public:
+    static constexpr std::size_t eventCount = 5;
+
+private:
+    PerfCounters &counters_;
+    std::array<int, eventCount> fds_{};
+
+public:
+    explicit PerfScope(PerfCounters &counters);
+    ~PerfScope();
+
+    PerfScope(PerfScope const &) = delete;
+    PerfScope &operator=(PerfScope const &) = delete;
+};
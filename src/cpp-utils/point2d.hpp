@@ -1,4 +1,6 @@
 #pragma once
+#include "hash.hpp"
+
 #include <cmath>
 #include <numeric>
 #include <ostream>
@@ -218,17 +220,10 @@ inline bool IsOnLine(Point2d a, Point2d b, Point2d c) noexcept
 template <>
 struct std::hash<Point2d>
 {
-    template <class T>
-    static inline void hash_combine(std::size_t &seed, T const &v)
-    {
-        seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-
     std::size_t operator()(Point2d const &p) const noexcept
     {
-        std::size_t value = 0;
-        hash_combine(value, p.x);
-        hash_combine(value, p.y);
-        return value;
+        // the key holds both coordinates and MixBits() is a bijection: distinct points never share a hash
+        auto const key = (PackCoordinate<32>(p.x) << 32) | PackCoordinate<32>(p.y);
+        return static_cast<std::size_t>(MixBits(key));
     }
 };
@@ -1,4 +1,6 @@
 #pragma once
+#include "hash.hpp"
+
 #include <cmath>
 #include <numeric>
 #include <ostream>
@@ -96,18 +98,11 @@ struct Point3d
 template <>
 struct std::hash<Point3d>
 {
-    template <class T>
-    static inline void hash_combine(std::size_t &seed, T const &v)
-    {
-        seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-
     std::size_t operator()(Point3d const &p) const noexcept
     {
-        std::size_t value = 0;
-        hash_combine(value, p.x);
-        hash_combine(value, p.y);
-        hash_combine(value, p.z);
-        return value;
+        // 21 bits per coordinate: points further apart than that may share a hash, which
+        // only costs a collision
+        auto const key = (PackCoordinate<21>(p.x) << 42) | (PackCoordinate<21>(p.y) << 21) | PackCoordinate<21>(p.z);
+        return static_cast<std::size_t>(MixBits(key));
     }
 };
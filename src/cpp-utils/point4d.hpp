@@ -1,4 +1,6 @@
 #pragma once
+#include "hash.hpp"
+
 #include <cmath>
 #include <numeric>
 #include <ostream>
@@ -102,19 +104,12 @@ struct Point4d
 template <>
 struct std::hash<Point4d>
 {
-    template <class T>
-    static inline void hash_combine(std::size_t &seed, T const &v)
-    {
-        seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-
     std::size_t operator()(Point4d const &p) const noexcept
     {
-        std::size_t value = 0;
-        hash_combine(value, p.x);
-        hash_combine(value, p.y);
-        hash_combine(value, p.z);
-        hash_combine(value, p.w);
-        return value;
+        // 16 bits per coordinate: points further apart than that may share a hash, which
+        // only costs a collision
+        auto const key = (PackCoordinate<16>(p.x) << 48) | (PackCoordinate<16>(p.y) << 32) |
+                         (PackCoordinate<16>(p.z) << 16) | PackCoordinate<16>(p.w);
+        return static_cast<std::size_t>(MixBits(key));
     }
 };
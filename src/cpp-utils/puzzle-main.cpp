@@ -0,0 +1,10 @@
+#include "puzzle.hpp"
+
+#include <cstdlib>
+
+int main()
+{
+    Puzzle puzzle;
+    Solve(puzzle);
+    return puzzle.Succeeded() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
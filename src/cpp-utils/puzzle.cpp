@@ -0,0 +1,101 @@
+#include "puzzle.hpp"
+
+#include "string.hpp"
+#include "terminal.hpp"
+
+#include <algorithm>
+#include <print>
+
+Puzzle::Puzzle(PuzzleOptions options)
+    : options_{options}
+{
+}
+
+void Puzzle::Title(int year, int day, std::string_view title)
+{
+    year_ = year;
+    day_ = day;
+    title_ = title;
+
+    if (options_.echo)
+    {
+        std::println("{}", FormatTitle());
+    }
+}
+
+bool Puzzle::IsSelected(int part) const
+{
+    return part > 0 && (options_.parts & (1u << (part - 1))) != 0;
+}
+
+void Puzzle::AllocationBudget(int part, std::size_t allocations)
+{
+    budgets_[part] = allocations;
+}
+
+bool Puzzle::IsInteractive() const
+{
+    return options_.interactive && IsTerminal(stdout);
+}
+
+void Puzzle::Record(Answer answer)
+{
+    if (auto const iter = budgets_.find(answer.part); iter != end(budgets_) && answer.allocations.has_value())
+    {
+        answer.budget = iter->second;
+        answer.ok = answer.ok && answer.allocations->count <= iter->second;
+    }
+
+    answers_.push_back(std::move(answer));
+
+    if (options_.echo)
+    {
+        std::println("{}", FormatAnswer(answers_.back()));
+    }
+}
+
+bool Puzzle::Succeeded() const
+{
+    return std::ranges::all_of(answers_, &Answer::ok);
+}
+
+std::string Puzzle::FormatTitle() const
+{
+    return std::format("Day {}, {}: {}", day_, year_, title_);
+}
+
+std::string Puzzle::FormatAnswer(Answer const &answer)
+{
+    std::string_view value = answer.value;
+    rtrim_if(value,
+        [](char c)
+        {
+            return c == '\n';
+        });
+
+    // multi-line answers (rendered letters) start on their own line
+    auto const sep = value.contains('\n') ? "\n" : " ";
+    std::string text = std::format("  Part {}:{}{}", answer.part, sep, value);
+
+    if (answer.value != answer.expected && not answer.expected.empty())
+    {
+        text += std::format(" (expected {})", answer.expected);
+    }
+
+    if (answer.budget.has_value() && answer.allocations->count > *answer.budget)
+    {
+        text += std::format(" ({} allocations, budget {})", answer.allocations->count, *answer.budget);
+    }
+
+    if (answer.stats.has_value())
+    {
+        text += std::format(" [{}]", FormatStats(*answer.stats));
+    }
+
+    if (answer.counters.has_value())
+    {
+        text += std::format(" [{}]", FormatCounters(*answer.counters));
+    }
+
+    return text;
+}
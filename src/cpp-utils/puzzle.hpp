@@ -0,0 +1,196 @@
+#pragma once
+#include "benchmark.hpp"
+#include "perf.hpp"
+
+#include <cstddef>
+#include <format>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct PuzzleOptions
+{
+    // bit N-1 selects part N
+    unsigned parts = 0b11;
+
+    // print the title and the answers as soon as they are known
+    bool echo = true;
+
+    // allow animations and progress reports on the terminal
+    bool interactive = true;
+
+    // when set, every part is timed instead of being called once
+    std::optional<BenchmarkOptions> benchmark;
+
+    // count the hardware events of every part (see PerfScope)
+    bool perf = false;
+
+    // fail the parts that allocate more than declared with Puzzle::AllocationBudget()
+    bool budgets = false;
+};
+
+class Puzzle
+{
+public:
+    struct Answer
+    {
+        int part = 0;
+        std::string value;
+        std::string expected;
+        bool ok = true;
+        std::optional<BenchmarkStats> stats;
+        std::optional<PerfCounters> counters;
+
+        // measured in budget mode, for the worst call when benchmarking
+        std::optional<AllocationStats> allocations;
+        std::optional<std::size_t> budget;
+    };
+
+private:
+    PuzzleOptions options_;
+    int year_ = 0;
+    int day_ = 0;
+    std::string title_;
+    std::vector<Answer> answers_;
+    std::map<int, std::size_t> budgets_;
+
+    void Record(Answer answer);
+
+    // answer.stats, answer.counters and answer.allocations are filled as requested by the options
+    template <typename FuncT>
+    [[nodiscard]] auto Compute(FuncT &func, Answer &answer) const
+    {
+        auto *const counters = options_.perf ? &answer.counters.emplace() : nullptr;
+
+        if (options_.benchmark.has_value())
+        {
+            auto result = Benchmark(*options_.benchmark, func, answer.stats.emplace(), counters);
+
+            if (options_.budgets)
+            {
+                answer.allocations = answer.stats->allocations;
+            }
+
+            return result;
+        }
+
+        std::optional<PerfScope> scope;
+        std::optional<AllocationScope> allocations;
+
+        if (counters != nullptr)
+        {
+            scope.emplace(*counters);
+        }
+
+        if (options_.budgets)
+        {
+            allocations.emplace();
+        }
+
+        auto result = func();
+
+        if (allocations.has_value())
+        {
+            answer.allocations = allocations->Stats();
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    static constexpr bool IsInteger = std::is_integral_v<T> && not std::is_same_v<T, bool> && not std::is_same_v<T, char>;
+
+    template <typename ExpectedT, typename ValueT>
+    [[nodiscard]] static bool IsExpected(ExpectedT const &expected, ValueT const &value)
+    {
+        if constexpr (IsInteger<ExpectedT> && IsInteger<ValueT>)
+        {
+            return std::cmp_equal(expected, value);
+        }
+        else
+        {
+            return expected == value;
+        }
+    }
+
+public:
+    explicit Puzzle(PuzzleOptions options = {});
+
+    void Title(int year, int day, std::string_view title);
+
+    [[nodiscard]] bool IsSelected(int part) const;
+
+    // Most calls to operator new a part may make, checked when PuzzleOptions::budgets is set.
+    // An input mapped at runtime is opened by the first part reading it, which allocates:
+    // such runs are only reliable with a warmup (--bench).
+    void AllocationBudget(int part, std::size_t allocations);
+
+    // true when a day may draw on stdout while it computes
+    [[nodiscard]] bool IsInteractive() const;
+
+    // Computes a part whose answer is not known yet
+    template <typename FuncT>
+    void Part(int part, FuncT &&func)
+    {
+        if (not IsSelected(part))
+        {
+            return;
+        }
+
+        Answer answer;
+        answer.part = part;
+        auto const value = Compute(func, answer);
+        answer.value = std::format("{}", value);
+        Record(std::move(answer));
+    }
+
+    // Computes a part and checks its answer against the expected value
+    template <typename ExpectedT, typename FuncT>
+    void Part(int part, ExpectedT const &expected, FuncT &&func)
+    {
+        if (not IsSelected(part))
+        {
+            return;
+        }
+
+        Answer answer;
+        answer.part = part;
+        auto const value = Compute(func, answer);
+        answer.value = std::format("{}", value);
+        answer.expected = std::format("{}", expected);
+        answer.ok = IsExpected(expected, value);
+        Record(std::move(answer));
+    }
+
+    [[nodiscard]] int Year() const
+    {
+        return year_;
+    }
+
+    [[nodiscard]] int Day() const
+    {
+        return day_;
+    }
+
+    [[nodiscard]] std::string const &GetTitle() const
+    {
+        return title_;
+    }
+
+    [[nodiscard]] std::vector<Answer> const &Answers() const
+    {
+        return answers_;
+    }
+
+    [[nodiscard]] bool Succeeded() const;
+
+    [[nodiscard]] std::string FormatTitle() const;
+    [[nodiscard]] static std::string FormatAnswer(Answer const &answer);
+};
+
+// Implemented once per day, called by the standalone executables and by aoc-runner
+void Solve(Puzzle &puzzle);
@@ -0,0 +1,152 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AOC_SCAN_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Separator positions are looked for 64 bytes at a time: every chunk is compared
+// against each separator with SIMD instructions (AVX2 when the compiler targets it,
+// SSE2 otherwise) and the matches are kept as a bitmap, bit i standing for byte i.
+// Going from one separator to the next is then a count of trailing zeros, so the
+// cost of a scan depends on the size of the text rather than on how many fields it
+// holds.
+
+inline constexpr std::size_t scanChunkSize = 64;
+
+// bit i is set when chunk[i] == c, the 64 bytes must be readable
+[[nodiscard]] inline std::uint64_t MatchChunk(char const *chunk, char c)
+{
+#if defined(__AVX2__)
+    auto const needle = _mm256_set1_epi8(c);
+    // NOLINTBEGIN: cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic
+    auto const low = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(chunk));
+    auto const high = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(chunk + 32));
+    // NOLINTEND
+    auto const lowMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needle)));
+    auto const highMask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needle)));
+    return lowMask | (std::uint64_t{highMask} << 32);
+#elif defined(AOC_SCAN_SSE2)
+    auto const needle = _mm_set1_epi8(c);
+    std::uint64_t mask = 0;
+
+    for (std::size_t i = 0; i != scanChunkSize; i += 16)
+    {
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic
+        auto const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const *>(chunk + i));
+        auto const matches = static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle)));
+        mask |= std::uint64_t{matches} << i;
+    }
+
+    return mask;
+#else
+    // simple enough for the compiler to vectorize on its own
+    std::uint64_t mask = 0;
+
+    for (std::size_t i = 0; i != scanChunkSize; ++i)
+    {
+        // NOLINTNEXTLINE: cppcoreguidelines-pro-bounds-pointer-arithmetic
+        mask |= std::uint64_t{chunk[i] == c} << i;
+    }
+
+    return mask;
+#endif
+}
+
+// bit i is set when text[offset + i] is one of the separators, bits past the end of
+// the text are cleared
+[[nodiscard]] inline std::uint64_t MatchChunk(std::string_view text, std::size_t offset, std::string_view separators)
+{
+    auto const size = text.size() - offset;
+    char const *chunk = text.data() + offset; // NOLINT: cppcoreguidelines-pro-bounds-pointer-arithmetic
+    std::array<char, scanChunkSize> padded;
+
+    // never read past the end of the text, a mapped input may end on a page boundary
+    if (size < scanChunkSize)
+    {
+        padded.fill('\0');
+        std::memcpy(padded.data(), chunk, size);
+        chunk = padded.data();
+    }
+
+    std::uint64_t mask = 0;
+
+    for (char const c : separators)
+    {
+        mask |= MatchChunk(chunk, c);
+    }
+
+    return size < scanChunkSize ? mask & ((std::uint64_t{1} << size) - 1) : mask;
+}
+
+// Yields the positions of the separators found in a text, in increasing order
+class SeparatorScanner
+{
+    std::string_view text_;
+    std::string_view separators_;
+    std::size_t offset_ = 0;
+    std::uint64_t mask_ = 0;
+
+public:
+    SeparatorScanner() = default;
+
+    // separators must outlive the scanner
+    SeparatorScanner(std::string_view text, std::string_view separators, std::size_t from = 0)
+        : text_{text}
+        , separators_{separators}
+        , offset_{std::min(from, text.size())}
+    {
+        if (offset_ < text_.size())
+        {
+            mask_ = MatchChunk(text_, offset_, separators_);
+        }
+    }
+
+    // position of the next separator, npos once the text is exhausted
+    [[nodiscard]] std::size_t Next()
+    {
+        while (mask_ == 0)
+        {
+            if (text_.size() - offset_ <= scanChunkSize)
+            {
+                offset_ = text_.size();
+                return std::string_view::npos;
+            }
+
+            offset_ += scanChunkSize;
+            mask_ = MatchChunk(text_, offset_, separators_);
+        }
+
+        auto const pos = offset_ + static_cast<std::size_t>(std::countr_zero(mask_));
+        mask_ &= mask_ - 1;
+        return pos;
+    }
+};
+
+// number of separators in the text
+[[nodiscard]] inline std::size_t CountSeparators(std::string_view text, std::string_view separators)
+{
+    std::size_t count = 0;
+
+    for (std::size_t offset = 0; offset < text.size(); offset += scanChunkSize)
+    {
+        count += static_cast<std::size_t>(std::popcount(MatchChunk(text, offset, separators)));
+    }
+
+    return count;
+}
+
+// same as text.find(separator, from)
+[[nodiscard]] inline std::size_t FindSeparator(std::string_view text, char const &separator, std::size_t from = 0)
+{
+    return SeparatorScanner{text, {&separator, 1}, from}.Next();
+}
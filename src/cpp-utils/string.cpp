@@ -1,41 +1,61 @@
 #include "string.hpp"
 
-std::vector<std::string_view> Split(std::string_view text, std::string_view sep)
+template <typename VectorT>
+static VectorT SplitInto(std::string_view text, std::string_view sep, VectorT result)
 {
-    std::vector<std::string_view> result;
-    std::size_t offset = 0;
-    auto pos = text.find(sep, offset);
-
-    while (pos != std::string_view::npos)
+    for (auto piece : Fields(text, sep))
     {
-        result.emplace_back(text.substr(offset, pos - offset));
-        offset = pos + sep.size();
-        pos = text.find(sep, offset);
+        result.emplace_back(piece);
     }
 
-    result.emplace_back(text.substr(offset));
     return result;
 }
 
-std::vector<std::string_view> SplitFirstOf(std::string_view text, std::string_view sep)
+template <typename VectorT>
+static VectorT SplitFirstOfInto(std::string_view text, std::string_view sep, VectorT result)
 {
-    std::vector<std::string_view> result;
     std::size_t offset = 0;
-    auto pos = text.find_first_of(sep, offset);
+    SeparatorScanner scanner{text, sep};
+    auto pos = scanner.Next();
 
     while (pos != std::string_view::npos)
     {
         result.emplace_back(text.substr(offset, pos - offset));
-        offset = text.find_first_not_of(sep, pos);
+        offset = pos + 1;
 
-        if (offset == std::string_view::npos)
+        // a run of separators counts as one
+        while ((pos = scanner.Next()) == offset)
         {
-            return result;
+            ++offset;
         }
 
-        pos = text.find_first_of(sep, offset);
+        if (offset == text.size())
+        {
+            return result;
+        }
     }
 
     result.emplace_back(text.substr(offset));
     return result;
 }
+
+std::vector<std::string_view> Split(std::string_view text, std::string_view sep)
+{
+    return SplitInto(text, sep, std::vector<std::string_view>{});
+}
+
+std::vector<std::string_view> SplitFirstOf(std::string_view text, std::string_view sep)
+{
+    return SplitFirstOfInto(text, sep, std::vector<std::string_view>{});
+}
+
+std::pmr::vector<std::string_view> Split(std::string_view text, std::string_view sep, std::pmr::memory_resource *resource)
+{
+    return SplitInto(text, sep, std::pmr::vector<std::string_view>{resource});
+}
+
+std::pmr::vector<std::string_view> SplitFirstOf(
+    std::string_view text, std::string_view sep, std::pmr::memory_resource *resource)
+{
+    return SplitFirstOfInto(text, sep, std::pmr::vector<std::string_view>{resource});
+}
@@ -1,12 +1,27 @@
 #pragma once
+#include "scan.hpp"
+
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cctype>
 #include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <iterator>
+#include <limits>
 #include <locale>
+#include <memory_resource>
 #include <numeric>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #if __has_include(<version>)
@@ -21,12 +36,177 @@
     return Split(text, std::string_view{&sep, 1});
 }
 
+// same, allocating the result from resource (an Arena for instance)
+[[nodiscard]] std::pmr::vector<std::string_view> Split(
+    std::string_view text, std::string_view sep, std::pmr::memory_resource *resource);
+[[nodiscard]] std::pmr::vector<std::string_view> SplitFirstOf(
+    std::string_view text, std::string_view sep, std::pmr::memory_resource *resource);
+
+[[nodiscard]] inline std::pmr::vector<std::string_view> Split(
+    std::string_view text, char sep, std::pmr::memory_resource *resource)
+{
+    return Split(text, std::string_view{&sep, 1}, resource);
+}
+
+// Lazy counterpart of Split(): yields the same pieces, one at a time and without allocating
+class SplitView : public std::ranges::view_interface<SplitView>
+{
+    std::string_view text_;
+    std::string_view sep_;
+
+public:
+    class Iterator
+    {
+        std::string_view text_;
+        std::string_view sep_;
+        SeparatorScanner scanner_;
+        std::size_t start_ = 0;
+        std::size_t end_ = 0;
+        bool done_ = true;
+
+        // the scanner only knows about the first character of the separator
+        [[nodiscard]] std::size_t FindEnd()
+        {
+            for (auto pos = scanner_.Next(); pos != text_.npos; pos = scanner_.Next())
+            {
+                if (pos >= start_ && (sep_.size() == 1 || text_.compare(pos, sep_.size(), sep_) == 0))
+                {
+                    return pos;
+                }
+            }
+
+            return text_.npos;
+        }
+
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        Iterator(std::string_view text, std::string_view sep)
+            : text_{text}
+            , sep_{sep}
+            , scanner_{text, sep.substr(0, 1)}
+            , end_{FindEnd()}
+            , done_{false}
+        {
+        }
+
+        [[nodiscard]] std::string_view operator*() const
+        {
+            return text_.substr(start_, end_ - start_);
+        }
+
+        Iterator &operator++()
+        {
+            if (end_ == text_.npos)
+            {
+                done_ = true;
+            }
+            else
+            {
+                start_ = end_ + sep_.size();
+                end_ = FindEnd();
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]] bool operator==(Iterator const &other) const
+        {
+            return done_ == other.done_ && (done_ || start_ == other.start_);
+        }
+
+        [[nodiscard]] bool operator==(std::default_sentinel_t /*unused*/) const
+        {
+            return done_;
+        }
+    };
+
+    SplitView() = default;
+
+    SplitView(std::string_view text, std::string_view sep)
+        : text_{text}
+        , sep_{sep}
+    {
+    }
+
+    [[nodiscard]] Iterator begin() const
+    {
+        return {text_, sep_};
+    }
+
+    [[nodiscard]] std::default_sentinel_t end() const
+    {
+        return std::default_sentinel;
+    }
+};
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<SplitView> = true;
+
+// Separators must outlive the views, a char is turned into a view of this table
+inline constexpr auto splitChars = []
+{
+    std::array<char, 256> chars{};
+
+    for (std::size_t i = 0; i != chars.size(); ++i)
+    {
+        chars[i] = static_cast<char>(i);
+    }
+
+    return chars;
+}();
+
+[[nodiscard]] inline SplitView Fields(std::string_view text, char sep)
+{
+    return {text, {&splitChars[static_cast<unsigned char>(sep)], 1}};
+}
+
+[[nodiscard]] inline SplitView Fields(std::string_view text, std::string_view sep)
+{
+    return {text, sep};
+}
+
+// the views point into the text, which a temporary string would not outlive
+template <std::same_as<std::string> String, class Sep>
+SplitView Fields(String &&text, Sep sep) = delete;
+template <std::same_as<std::string> String>
+SplitView Lines(String &&text) = delete;
+template <std::same_as<std::string> String>
+SplitView Blocks(String &&text) = delete;
+
+[[nodiscard]] inline SplitView Lines(std::string_view text)
+{
+    return Fields(text, '\n');
+}
+
+// groups of lines separated by an empty line
+[[nodiscard]] inline SplitView Blocks(std::string_view text)
+{
+    return Fields(text, "\n\n");
+}
+
 template <class T, class BinaryReductionOp, class UnaryTransformOp>
 [[nodiscard]] inline auto TransformReduceLines(std::string_view text, T &&init, BinaryReductionOp &&r, UnaryTransformOp &&t)
 {
-    auto const lines = Split(text, '\n');
-    return std::transform_reduce(begin(lines), end(lines), std::forward<T>(init), std::forward<BinaryReductionOp>(r),
-        std::forward<UnaryTransformOp>(t));
+    std::decay_t<T> result = std::forward<T>(init);
+
+    for (auto line : Lines(text))
+    {
+        result = r(std::move(result), t(line));
+    }
+
+    return result;
 }
 
 template <typename IterT>
@@ -171,13 +351,152 @@ template <typename PredicateT>
     return s;
 }
 
+// Value of the leading decimal digits of the text, at most 8 of them, and how many
+// there were. The 8 bytes are converted at once: the classic SWAR sequence merges
+// neighbouring digits into pairs, then quadruples, then the whole number. Up to
+// `readable` bytes from the start of the text may be loaded.
+[[nodiscard]] inline std::pair<std::uint32_t, std::size_t> ParseEightDigits(std::string_view text, std::size_t readable)
+{
+    // a zero byte is not a digit, which stops the number at the end of the buffer
+    std::uint64_t word = 0;
+    if (readable >= sizeof(word))
+    {
+        std::memcpy(&word, text.data(), sizeof(word));
+    }
+    else
+    {
+        std::memcpy(&word, text.data(), readable);
+    }
+
+    // the first byte is the lowest one on a little-endian machine
+    auto const digits = word - 0x3030'3030'3030'3030;
+    auto const nonDigits = (digits | (digits + 0x7676'7676'7676'7676)) & 0x8080'8080'8080'8080;
+    auto const found = nonDigits == 0 ? std::size_t{8} : static_cast<std::size_t>(std::countr_zero(nonDigits)) / 8;
+    auto const count = std::min(found, text.size());
+
+    // the digits past count are shifted out, the missing ones become leading zeros
+    auto value = count == 0 ? 0 : digits << (8 * (8 - count));
+    value = (value * 10) + (value >> 8);
+    value = (((value & 0x0000'00ff'0000'00ff) * (100 + (1'000'000ULL << 32))) +
+                (((value >> 16) & 0x0000'00ff'0000'00ff) * (1 + (10'000ULL << 32)))) >>
+        32;
+
+    return {static_cast<std::uint32_t>(value), count};
+}
+
+// svtoi() for a text followed by at least readable - text.size() more bytes
+template <typename IntT>
+[[nodiscard]] inline IntT ParseInteger(std::string_view text, std::size_t readable)
+{
+    auto const fromChars = [](std::string_view number)
+    {
+        IntT result = 0;
+        // NOLINTNEXTLINE cppcoreguidelines-pro-bounds-pointer-arithmetic
+        std::from_chars(number.data(), number.data() + number.size(), result);
+        return result;
+    };
+
+    if constexpr (std::endian::native != std::endian::little || sizeof(IntT) > sizeof(std::uint64_t))
+    {
+        return fromChars(text);
+    }
+    else
+    {
+        auto const number = text;
+        bool const negative = std::is_signed_v<IntT> && not text.empty() && text.front() == '-';
+
+        // without a branch, the signs of a list of numbers are hard to predict
+        text.remove_prefix(negative ? 1 : 0);
+        readable -= negative ? 1 : 0;
+
+        std::uint64_t result = 0;
+        std::size_t digits = 0;
+
+        while (true)
+        {
+            auto const [value, count] = ParseEightDigits(text, readable);
+            constexpr std::array<std::uint64_t, 9> scales{
+                1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000};
+            result = result * scales[count] + value;
+            digits += count;
+
+            if (count != 8)
+            {
+                break;
+            }
+
+            text.remove_prefix(8);
+            readable -= 8;
+        }
+
+        // 19 digits always fit in 64 bits, the longer numbers may have wrapped around
+        if (digits > 19) [[unlikely]]
+        {
+            return fromChars(number);
+        }
+
+        // out of the range of IntT: 0, the value std::from_chars leaves
+        auto const limit = static_cast<std::uint64_t>(std::numeric_limits<IntT>::max()) + (negative ? 1 : 0);
+
+        if (result > limit)
+        {
+            return 0;
+        }
+
+        return static_cast<IntT>(negative ? 0 - result : result);
+    }
+}
+
+// the integer at the start of text; 0 when there is none or when it does not fit IntT,
+// on every platform
 template <typename IntT = int>
 [[nodiscard]] inline IntT svtoi(std::string_view text)
 {
-    IntT result = 0;
-    // NOLINTNEXTLINE cppcoreguidelines-pro-bounds-pointer-arithmetic
-    std::from_chars(text.data(), text.data() + text.size(), result);
-    return result;
+    return ParseInteger<IntT>(text, text.size());
+}
+
+// Parses the integers separated by sep into numbers, as svtoi() would one field at a
+// time, and returns how many were written
+template <typename IntT>
+inline std::size_t ParseIntegers(std::string_view text, char sep, std::span<IntT> numbers)
+{
+    SeparatorScanner scanner{text, {&sep, 1}};
+    std::size_t start = 0;
+    std::size_t count = 0;
+
+    while (count != numbers.size())
+    {
+        auto const end = scanner.Next();
+        // the fields are followed by the rest of the text, so whole words can be loaded
+        numbers[count++] = ParseInteger<IntT>(text.substr(start, end - start), text.size() - start);
+
+        if (end == text.npos)
+        {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    return count;
+}
+
+template <typename IntT = int>
+[[nodiscard]] inline std::vector<IntT> ParseIntegers(std::string_view text, char sep)
+{
+    // counting the separators is cheap next to parsing, and sizes the vector once
+    std::vector<IntT> numbers(CountSeparators(text, {&sep, 1}) + 1);
+    ParseIntegers(text, sep, std::span{numbers});
+    return numbers;
+}
+
+template <typename IntT = int>
+[[nodiscard]] inline std::pmr::vector<IntT> ParseIntegers(
+    std::string_view text, char sep, std::pmr::memory_resource *resource)
+{
+    std::pmr::vector<IntT> numbers(CountSeparators(text, {&sep, 1}) + 1, resource);
+    ParseIntegers(text, sep, std::span{numbers});
+    return numbers;
 }
 
 template <typename IntT = int>
@@ -237,7 +556,7 @@ public:
     {
         std::string_view token = text_;
 
-        if (auto const pos = text_.find(sep); pos != text_.npos)
+        if (auto const pos = FindSeparator(text_, sep); pos != text_.npos)
         {
             token = text_.substr(0, pos);
             text_ = text_.substr(pos + 1);
@@ -251,7 +570,7 @@ public:
 {
     std::string_view token = input;
 
-    if (auto const pos = input.find(sep); pos != input.npos)
+    if (auto const pos = FindSeparator(input, sep); pos != input.npos)
     {
         token = input.substr(0, pos);
         input = input.substr(pos + 1);
@@ -262,7 +581,7 @@ public:
 
 inline bool SkipToken(std::string_view &input, char sep)
 {
-    if (auto const pos = input.find(sep); pos != input.npos)
+    if (auto const pos = FindSeparator(input, sep); pos != input.npos)
     {
         input = input.substr(pos + 1);
         return true;
@@ -0,0 +1,261 @@
+#pragma once
+#include "point2d.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Disjoint sets of the elements 0 to n - 1 (union-find): Find() halves the path to the
+// root as it goes and Unite() puts the tree of lower rank under the other, so that any
+// sequence of calls costs almost O(1) each. No recursion.
+class DisjointSets
+{
+    std::vector<int> parent_;
+    std::vector<std::uint8_t> rank_;
+    std::vector<int> size_;
+    int count_ = 0;
+
+    friend class GridDisjointSets;
+
+    [[nodiscard]] static std::size_t At(int i)
+    {
+        return static_cast<std::size_t>(i);
+    }
+
+    // Unite() without the count of sets, for the bands of GridDisjointSets::ConnectAll()
+    bool Link(int a, int b)
+    {
+        a = Find(a);
+        b = Find(b);
+
+        if (a == b)
+        {
+            return false;
+        }
+
+        if (rank_[At(a)] < rank_[At(b)])
+        {
+            std::swap(a, b);
+        }
+        else if (rank_[At(a)] == rank_[At(b)])
+        {
+            ++rank_[At(a)];
+        }
+
+        parent_[At(b)] = a;
+        size_[At(a)] += size_[At(b)];
+        return true;
+    }
+
+public:
+    DisjointSets() = default;
+
+    // n sets of one element
+    explicit DisjointSets(int n)
+        : parent_(At(n))
+        , rank_(At(n))
+        , size_(At(n), 1)
+        , count_{n}
+    {
+        std::iota(begin(parent_), end(parent_), 0);
+    }
+
+    // a new set of one element, the next index
+    int Add()
+    {
+        auto const i = static_cast<int>(parent_.size());
+        parent_.push_back(i);
+        rank_.push_back(0);
+        size_.push_back(1);
+        ++count_;
+        return i;
+    }
+
+    // the root of the set of i
+    [[nodiscard]] int Find(int i)
+    {
+        while (parent_[At(i)] != i)
+        {
+            parent_[At(i)] = parent_[At(parent_[At(i)])];
+            i = parent_[At(i)];
+        }
+
+        return i;
+    }
+
+    // false when a and b were already in the same set
+    bool Unite(int a, int b)
+    {
+        if (not Link(a, b))
+        {
+            return false;
+        }
+
+        --count_;
+        return true;
+    }
+
+    [[nodiscard]] bool Connected(int a, int b)
+    {
+        return Find(a) == Find(b);
+    }
+
+    // number of elements in the set of i
+    [[nodiscard]] int Size(int i)
+    {
+        return size_[At(Find(i))];
+    }
+
+    // number of sets
+    [[nodiscard]] int Count() const
+    {
+        return count_;
+    }
+
+    [[nodiscard]] int Elements() const
+    {
+        return static_cast<int>(parent_.size());
+    }
+};
+
+// Disjoint sets of the points of a rectangle, numbered row by row
+class GridDisjointSets
+{
+    DisjointSets sets_;
+    Point2d min_;
+    Point2d max_;
+
+    // links every point of the rows [first, last) to its right and lower neighbors in
+    // those rows; returns the number of links
+    template <typename ConnectedT>
+    int LinkRows(int first, int last, ConnectedT &connected)
+    {
+        int links = 0;
+
+        for (int y = first; y != last; ++y)
+        {
+            for (int x = min_.x; x <= max_.x; ++x)
+            {
+                Point2d const p{x, y};
+                Point2d const right = p + Point2d::EAST;
+                Point2d const below = p + Point2d::SOUTH;
+
+                if (x != max_.x && connected(p, right) && sets_.Link(Index(p), Index(right)))
+                {
+                    ++links;
+                }
+
+                if (y + 1 != last && connected(p, below) && sets_.Link(Index(p), Index(below)))
+                {
+                    ++links;
+                }
+            }
+        }
+
+        return links;
+    }
+
+public:
+    GridDisjointSets() = default;
+
+    // inclusive bounds, every point alone in its set
+    GridDisjointSets(Point2d min, Point2d max)
+        : sets_{(max.x - min.x + 1) * (max.y - min.y + 1)}
+        , min_{min}
+        , max_{max}
+    {
+    }
+
+    // Unchecked: p must be in the bounds
+    [[nodiscard]] int Index(Point2d p) const
+    {
+        return (p.y - min_.y) * (max_.x - min_.x + 1) + (p.x - min_.x);
+    }
+
+    [[nodiscard]] Point2d PointAt(int index) const
+    {
+        int const width = max_.x - min_.x + 1;
+        return {min_.x + index % width, min_.y + index / width};
+    }
+
+    // the root of the set of p
+    [[nodiscard]] Point2d Find(Point2d p)
+    {
+        return PointAt(sets_.Find(Index(p)));
+    }
+
+    bool Unite(Point2d a, Point2d b)
+    {
+        return sets_.Unite(Index(a), Index(b));
+    }
+
+    [[nodiscard]] bool Connected(Point2d a, Point2d b)
+    {
+        return sets_.Connected(Index(a), Index(b));
+    }
+
+    [[nodiscard]] int Size(Point2d p)
+    {
+        return sets_.Size(Index(p));
+    }
+
+    [[nodiscard]] int Count() const
+    {
+        return sets_.Count();
+    }
+
+    // Unites every point with its right and lower neighbors when connected(p, neighbor),
+    // in one scan. With several threads, each links the rows of a band on its own, as the
+    // bands share no element, then the rows on both sides of the seams are united:
+    // connected() must then be safe to call concurrently.
+    template <typename ConnectedT>
+    void ConnectAll(ConnectedT &&connected, int threads = 1)
+    {
+        int const height = max_.y - min_.y + 1;
+        int const bands = std::clamp(threads, 1, std::max(height, 1));
+        std::vector<int> firsts;
+        std::vector<int> links(static_cast<std::size_t>(bands));
+
+        for (int band = 0; band <= bands; ++band)
+        {
+            firsts.push_back(min_.y + static_cast<int>(std::int64_t{height} * band / bands));
+        }
+
+        {
+            std::vector<std::jthread> workers;
+
+            for (int band = 1; band < bands; ++band)
+            {
+                workers.emplace_back(
+                    [&, band]
+                    {
+                        auto const i = static_cast<std::size_t>(band);
+                        links[i] = LinkRows(firsts[i], firsts[i + 1], connected);
+                    });
+            }
+
+            links[0] = LinkRows(firsts[0], firsts[1], connected);
+        }
+
+        sets_.count_ -= std::reduce(begin(links), end(links));
+
+        for (int band = 1; band < bands; ++band)
+        {
+            int const y = firsts[static_cast<std::size_t>(band)];
+
+            for (int x = min_.x; x <= max_.x; ++x)
+            {
+                Point2d const p{x, y};
+
+                if (connected(p + Point2d::NORTH, p))
+                {
+                    Unite(p + Point2d::NORTH, p);
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,95 @@
+#pragma once
+
+// Every day is compiled into aoc-runner inside its own namespace (see Runner.cmake).
+// Headers must be included here, before that namespace is opened, so that the
+// includes done by the day itself are no-ops. A day that uses a new header must
+// have it added to this list.
+//
+// cpp-utils/input.hpp is deliberately left out: it refers to GetInput() and has
+// to be included from within the day's namespace.
+
+#include "../cpp-utils/arena.hpp"
+#include "../cpp-utils/assert.hpp"
+#include "../cpp-utils/bfs.hpp"
+#include "../cpp-utils/bucketqueue.hpp"
+#include "../cpp-utils/channel.hpp"
+#include "../cpp-utils/combinations.hpp"
+#include "../cpp-utils/dag.hpp"
+#include "../cpp-utils/defaultdict.hpp"
+#include "../cpp-utils/dijkstra.hpp"
+#include "../cpp-utils/extract.hpp"
+#include "../cpp-utils/flathash.hpp"
+#include "../cpp-utils/grid2d.hpp"
+#include "../cpp-utils/gridview.hpp"
+#include "../cpp-utils/hash.hpp"
+#include "../cpp-utils/input-file.hpp"
+#include "../cpp-utils/intcode.hpp"
+#include "../cpp-utils/intcodenetwork.hpp"
+#include "../cpp-utils/interner.hpp"
+#include "../cpp-utils/md5.hpp"
+#include "../cpp-utils/numbers.hpp"
+#include "../cpp-utils/pagedmemory.hpp"
+#include "../cpp-utils/perf.hpp"
+#include "../cpp-utils/point2d.hpp"
+#include "../cpp-utils/point3d.hpp"
+#include "../cpp-utils/point4d.hpp"
+#include "../cpp-utils/puzzle.hpp"
+#include "../cpp-utils/range.hpp"
+#include "../cpp-utils/scan.hpp"
+#include "../cpp-utils/string.hpp"
+#include "../cpp-utils/terminal.hpp"
+#include "../cpp-utils/unionfind.hpp"
+#include "../cpp-utils/utils.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cassert>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <locale>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <print>
+#include <random>
+#include <ranges>
+#include <regex>
+#include <set>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+#if __has_include(<ctre.hpp>)
+#include <ctre.hpp>
+#endif
+
+#if __has_include(<nlohmann/json.hpp>)
+#include <nlohmann/json.hpp>
+#endif
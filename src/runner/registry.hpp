@@ -0,0 +1,14 @@
+#pragma once
+#include "../cpp-utils/puzzle.hpp"
+
+#include <span>
+
+struct Solver
+{
+    int year;
+    int day;
+    void (*solve)(Puzzle &puzzle);
+};
+
+// Generated by Runner.cmake, in the order of the add_aoc() calls
+[[nodiscard]] std::span<Solver const> GetSolvers();
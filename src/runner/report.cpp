@@ -0,0 +1,129 @@
+#include "report.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <print>
+#include <stdexcept>
+#include <tuple>
+
+using json = nlohmann::json;
+
+void WriteReport(std::string const &path, BenchmarkOptions const &options, std::span<ReportEntry const> entries)
+{
+    json results = json::array();
+
+    for (auto const &entry : entries)
+    {
+        json result{
+            {"year", entry.year},
+            {"day", entry.day},
+            {"part", entry.part},
+            {"repetitions", entry.stats.repetitions},
+            {"min_ns", entry.stats.min.count()},
+            {"median_ns", entry.stats.median.count()},
+            {"p99_ns", entry.stats.p99.count()},
+            {"allocations", entry.stats.allocations.count},
+            {"allocated_bytes", entry.stats.allocations.bytes},
+            {"peak_bytes", entry.stats.allocations.peakBytes},
+        };
+
+        if (entry.counters.has_value())
+        {
+            auto const add = [&result](char const *name, std::optional<std::uint64_t> const &value)
+            {
+                if (value.has_value())
+                {
+                    result[name] = *value;
+                }
+            };
+
+            add("cycles", entry.counters->cycles);
+            add("instructions", entry.counters->instructions);
+            add("branch_misses", entry.counters->branchMisses);
+            add("l1d_misses", entry.counters->l1dMisses);
+            add("llc_misses", entry.counters->llcMisses);
+        }
+
+        results.push_back(result);
+    }
+
+    json const report{
+        {"warmup", options.warmup},
+        {"repetitions", options.repetitions},
+        {"results", results},
+    };
+
+    std::ofstream out{path};
+
+    if (not out)
+    {
+        throw std::runtime_error("cannot write " + path);
+    }
+
+    out << report.dump(2) << '\n';
+}
+
+std::vector<ReportEntry> ReadReport(std::string const &path)
+{
+    std::ifstream in{path};
+
+    if (not in)
+    {
+        throw std::runtime_error("cannot read " + path);
+    }
+
+    std::vector<ReportEntry> entries;
+
+    for (auto const &result : json::parse(in).at("results"))
+    {
+        ReportEntry entry{
+            result.at("year").get<int>(), result.at("day").get<int>(), result.at("part").get<int>(), {}, {}};
+        entry.stats.repetitions = result.at("repetitions").get<unsigned>();
+        entry.stats.min = std::chrono::nanoseconds{result.at("min_ns").get<std::int64_t>()};
+        entry.stats.median = std::chrono::nanoseconds{result.at("median_ns").get<std::int64_t>()};
+        entry.stats.p99 = std::chrono::nanoseconds{result.at("p99_ns").get<std::int64_t>()};
+        entry.stats.allocations.count = result.at("allocations").get<std::size_t>();
+
+        // missing from the reports written before they were measured
+        entry.stats.allocations.bytes = result.value("allocated_bytes", std::size_t{0});
+        entry.stats.allocations.peakBytes = result.value("peak_bytes", std::size_t{0});
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+int CompareToBaseline(std::span<ReportEntry const> entries, std::span<ReportEntry const> baseline, int thresholdPercent)
+{
+    int regressions = 0;
+
+    for (auto const &entry : entries)
+    {
+        auto const iter = std::ranges::find_if(baseline,
+            [&entry](ReportEntry const &base)
+            {
+                return std::tie(base.year, base.day, base.part) == std::tie(entry.year, entry.day, entry.part);
+            });
+
+        if (iter == end(baseline) || iter->stats.median.count() == 0)
+        {
+            continue;
+        }
+
+        auto const before = iter->stats.median.count();
+        auto const after = entry.stats.median.count();
+        auto const percent = (after - before) * 100 / before;
+
+        if (percent > thresholdPercent)
+        {
+            std::println("Regression {}-{} part {}: median {} ns -> {} ns (+{}%)", entry.year, entry.day, entry.part,
+                before, after, percent);
+            ++regressions;
+        }
+    }
+
+    return regressions;
+}
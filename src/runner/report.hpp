@@ -0,0 +1,26 @@
+#pragma once
+#include "../cpp-utils/benchmark.hpp"
+#include "../cpp-utils/perf.hpp"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+struct ReportEntry
+{
+    int year = 0;
+    int day = 0;
+    int part = 0;
+    BenchmarkStats stats;
+
+    // per call, with --perf
+    std::optional<PerfCounters> counters;
+};
+
+void WriteReport(std::string const &path, BenchmarkOptions const &options, std::span<ReportEntry const> entries);
+[[nodiscard]] std::vector<ReportEntry> ReadReport(std::string const &path);
+
+// Prints the entries whose median time grew by more than thresholdPercent and returns their count
+[[nodiscard]] int CompareToBaseline(
+    std::span<ReportEntry const> entries, std::span<ReportEntry const> baseline, int thresholdPercent);
@@ -0,0 +1,368 @@
+#include "registry.hpp"
+#include "report.hpp"
+#include "scheduler.hpp"
+
+#include "../cpp-utils/puzzle.hpp"
+#include "../cpp-utils/string.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct Filter
+{
+    int year = 0;
+    int day = 0;
+
+    [[nodiscard]] bool Matches(Solver const &solver) const
+    {
+        return solver.year == year && (day == 0 || solver.day == day);
+    }
+};
+
+struct Options
+{
+    std::vector<Filter> filters;
+    std::optional<BenchmarkOptions> benchmark;
+    bool perf = false;
+    bool budgets = false;
+    std::string jsonPath;
+    std::string baselinePath;
+    int threshold = 10;
+    unsigned jobs = 0;
+};
+
+static constexpr std::string_view usage = R"(usage: aoc-runner [options] [year[/day]]...
+  --bench             time every part
+  --warmup N          untimed calls before measuring (default 1)
+  --repeat N          timed calls per part (default 10)
+  --perf              count cycles, instructions, branch and cache misses (Linux)
+  --budget            fail the parts that allocate more than their declared budget
+  --json FILE         write the timings to FILE
+  --baseline FILE     compare the timings with a report written by --json
+  --threshold PERCENT median slowdown reported as a regression (default 10)
+  --jobs N            parts solved in parallel (default: all cores, 1 with --bench))";
+
+// accepts "2019", "2019/5" or "2019-5"
+static std::optional<Filter> ParseFilter(std::string_view arg)
+{
+    auto const pos = arg.find_first_of("/-");
+    Filter filter{svtoi(arg.substr(0, pos)), 0};
+
+    if (pos != arg.npos)
+    {
+        filter.day = svtoi(arg.substr(pos + 1));
+
+        if (filter.day <= 0)
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (filter.year <= 0)
+    {
+        return std::nullopt;
+    }
+
+    return filter;
+}
+
+static BenchmarkOptions &EnableBenchmark(Options &options)
+{
+    if (not options.benchmark.has_value())
+    {
+        options.benchmark.emplace();
+    }
+
+    return *options.benchmark;
+}
+
+static std::optional<Options> ParseOptions(std::span<char *> args)
+{
+    Options options;
+
+    for (auto iter = begin(args); iter != end(args); ++iter)
+    {
+        std::string_view const arg = *iter;
+
+        if (arg == "--bench")
+        {
+            EnableBenchmark(options);
+            continue;
+        }
+
+        if (arg == "--perf")
+        {
+            options.perf = true;
+            continue;
+        }
+
+        if (arg == "--budget")
+        {
+            options.budgets = true;
+            continue;
+        }
+
+        if (not arg.starts_with("--"))
+        {
+            auto const filter = ParseFilter(arg);
+
+            if (not filter.has_value())
+            {
+                return std::nullopt;
+            }
+
+            options.filters.push_back(*filter);
+            continue;
+        }
+
+        if (std::next(iter) == end(args))
+        {
+            return std::nullopt;
+        }
+
+        std::string_view const value = *++iter;
+
+        if (arg == "--warmup")
+        {
+            EnableBenchmark(options).warmup = svtoi<unsigned>(value);
+        }
+        else if (arg == "--repeat")
+        {
+            EnableBenchmark(options).repetitions = std::max(svtoi<unsigned>(value), 1u);
+        }
+        else if (arg == "--json")
+        {
+            options.jsonPath = value;
+        }
+        else if (arg == "--baseline")
+        {
+            options.baselinePath = value;
+        }
+        else if (arg == "--threshold")
+        {
+            options.threshold = svtoi(value);
+        }
+        else if (arg == "--jobs")
+        {
+            options.jobs = std::max(svtoi<unsigned>(value), 1u);
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    // a report needs timings
+    if (not options.jsonPath.empty() || not options.baselinePath.empty())
+    {
+        EnableBenchmark(options);
+    }
+
+    // timings are only meaningful when the parts do not compete for the cores
+    if (options.jobs == 0)
+    {
+        options.jobs = options.benchmark.has_value() ? 1 : std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    return options;
+}
+
+static constexpr int partCount = 2;
+
+struct PartRun
+{
+    Puzzle puzzle;
+    std::string error;
+};
+
+struct DayRun
+{
+    Solver solver;
+    std::array<PartRun, partCount> parts;
+    int pending = partCount;
+};
+
+// Collects the parts as they complete and prints the days in order
+class Sweep
+{
+    std::vector<DayRun> days_;
+    std::mutex mutex_;
+    std::size_t printed_ = 0;
+    int failed_ = 0;
+    std::vector<ReportEntry> entries_;
+
+    bool Print(DayRun const &day)
+    {
+        bool ok = true;
+        std::println("{}", day.parts.front().puzzle.FormatTitle());
+
+        for (auto const &run : day.parts)
+        {
+            if (not run.error.empty())
+            {
+                std::println(stderr, "{}-{}: {}", day.solver.year, day.solver.day, run.error);
+                ok = false;
+                continue;
+            }
+
+            for (auto const &answer : run.puzzle.Answers())
+            {
+                std::println("{}", Puzzle::FormatAnswer(answer));
+
+                if (answer.stats.has_value())
+                {
+                    entries_.push_back({day.solver.year, day.solver.day, answer.part, *answer.stats, answer.counters});
+                }
+            }
+
+            ok = ok && run.puzzle.Succeeded();
+        }
+
+        return ok;
+    }
+
+public:
+    explicit Sweep(std::vector<Solver> const &solvers)
+        : days_(solvers.size())
+    {
+        for (std::size_t i = 0; i != solvers.size(); ++i)
+        {
+            days_[i].solver = solvers[i];
+        }
+    }
+
+    [[nodiscard]] std::size_t Size() const
+    {
+        return days_.size();
+    }
+
+    // Each part runs Solve() with only that part selected
+    void Solve(std::size_t index, int part, PuzzleOptions options)
+    {
+        auto &day = days_[index];
+        auto &run = day.parts[static_cast<std::size_t>(part - 1)];
+        options.parts = 1u << (part - 1);
+        run.puzzle = Puzzle{options};
+
+        try
+        {
+            day.solver.solve(run.puzzle);
+        }
+        catch (std::exception const &e)
+        {
+            run.error = e.what();
+        }
+
+        std::scoped_lock lock{mutex_};
+        --day.pending;
+
+        for (; printed_ != days_.size() && days_[printed_].pending == 0; ++printed_)
+        {
+            if (not Print(days_[printed_]))
+            {
+                ++failed_;
+            }
+        }
+    }
+
+    [[nodiscard]] int Failed() const
+    {
+        return failed_;
+    }
+
+    [[nodiscard]] std::vector<ReportEntry> const &Entries() const
+    {
+        return entries_;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    auto const options = ParseOptions(std::span(argv, static_cast<std::size_t>(argc)).subspan(1));
+
+    if (not options.has_value())
+    {
+        std::println(stderr, "{}", usage);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Solver> solvers;
+    std::ranges::copy_if(GetSolvers(), std::back_inserter(solvers),
+        [&options](Solver const &solver)
+        {
+            return options->filters.empty() || std::ranges::any_of(options->filters,
+                [&solver](Filter const &filter)
+                {
+                    return filter.Matches(solver);
+                });
+        });
+
+    std::ranges::sort(solvers,
+        [](Solver const &a, Solver const &b)
+        {
+            return std::tie(a.year, a.day) < std::tie(b.year, b.day);
+        });
+
+    // answers are printed by the sweep, days only draw when they have the terminal to themselves
+    PuzzleOptions const puzzleOptions{
+        .echo = false,
+        .interactive = options->jobs == 1,
+        .benchmark = options->benchmark,
+        .perf = options->perf,
+        .budgets = options->budgets,
+    };
+
+    Sweep sweep{solvers};
+    Scheduler scheduler{options->jobs};
+
+    for (std::size_t i = 0; i != sweep.Size(); ++i)
+    {
+        for (int part = 1; part <= partCount; ++part)
+        {
+            scheduler.Add(
+                [&sweep, &puzzleOptions, i, part]
+                {
+                    sweep.Solve(i, part, puzzleOptions);
+                });
+        }
+    }
+
+    scheduler.Run();
+
+    auto const failed = sweep.Failed();
+    std::println("{} puzzles, {} failed", sweep.Size(), failed);
+    int regressions = 0;
+
+    try
+    {
+        if (not options->jsonPath.empty())
+        {
+            WriteReport(options->jsonPath, *options->benchmark, sweep.Entries());
+        }
+
+        if (not options->baselinePath.empty())
+        {
+            regressions = CompareToBaseline(sweep.Entries(), ReadReport(options->baselinePath), options->threshold);
+            std::println("{} regressions above {}%", regressions, options->threshold);
+        }
+    }
+    catch (std::exception const &e)
+    {
+        std::println(stderr, "{}", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return failed == 0 && regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
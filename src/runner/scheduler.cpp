@@ -0,0 +1,96 @@
+#include "scheduler.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+Scheduler::Scheduler(std::size_t threadCount)
+{
+    workers_.resize(std::max<std::size_t>(threadCount, 1));
+
+    for (auto &worker : workers_)
+    {
+        worker = std::make_unique<Worker>();
+    }
+}
+
+void Scheduler::Add(Job job)
+{
+    auto &worker = *workers_[next_];
+    next_ = (next_ + 1) % workers_.size();
+
+    std::scoped_lock lock{worker.mutex};
+    worker.jobs.push_back(std::move(job));
+}
+
+std::optional<Scheduler::Job> Scheduler::Pop(std::size_t index)
+{
+    auto &worker = *workers_[index];
+    std::scoped_lock lock{worker.mutex};
+
+    if (worker.jobs.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto job = std::move(worker.jobs.front());
+    worker.jobs.pop_front();
+    return job;
+}
+
+std::optional<Scheduler::Job> Scheduler::Steal(std::size_t thief)
+{
+    for (std::size_t i = 1; i != workers_.size(); ++i)
+    {
+        auto &victim = *workers_[(thief + i) % workers_.size()];
+        std::scoped_lock lock{victim.mutex};
+
+        if (not victim.jobs.empty())
+        {
+            auto job = std::move(victim.jobs.back());
+            victim.jobs.pop_back();
+            return job;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void Scheduler::Work(std::size_t index)
+{
+    // no job is added while running, so empty deques everywhere means we are done
+    while (true)
+    {
+        auto job = Pop(index);
+
+        if (not job.has_value())
+        {
+            job = Steal(index);
+        }
+
+        if (not job.has_value())
+        {
+            return;
+        }
+
+        (*job)();
+    }
+}
+
+void Scheduler::Run()
+{
+    std::vector<std::jthread> threads;
+    threads.reserve(workers_.size() - 1);
+
+    for (std::size_t i = 1; i != workers_.size(); ++i)
+    {
+        threads.emplace_back(
+            [this, i]
+            {
+                Work(i);
+            });
+    }
+
+    // the calling thread is worker 0
+    Work(0);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+// Runs independent jobs on a pool of threads. Every worker owns a deque: it takes
+// its own jobs from the front, in the order they were added, and once it runs dry
+// steals from the back of the other deques, so a few slow jobs do not hold back
+// the rest of the queue.
+class Scheduler
+{
+public:
+    using Job = std::function<void()>;
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::size_t next_ = 0;
+
+    [[nodiscard]] std::optional<Job> Pop(std::size_t index);
+    [[nodiscard]] std::optional<Job> Steal(std::size_t thief);
+    void Work(std::size_t index);
+
+public:
+    explicit Scheduler(std::size_t threadCount);
+
+    // Jobs are dealt to the workers in turn, they must all be added before Run()
+    void Add(Job job);
+
+    // Returns once every job has run
+    void Run();
+};